@@ -0,0 +1,333 @@
+#include <cstddef>      // size_t
+#include <cstdlib>      // atoi
+#include <ctime>        // clock
+#include <chrono>       // steady_clock, duration
+#include <thread>       // thread, hardware_concurrency
+#include <vector>       // vector
+#include <atomic>       // atomic
+#include <algorithm>    // sort, max
+#include <string>       // string
+#include <iostream>     // cout
+#include <iomanip>      // setw, setprecision
+
+#include "ThreadPool.hpp"
+
+// Micro benchmarks for the thread pool, every case is run for every combination of scheduling mode
+// and queue backend, so the results of different modes can be compared line by line.
+// Usage: benchmark_thread_pool [scale], scale multiplies the number of jobs per case (default 1).
+
+using Clock_t = std::chrono::steady_clock;
+
+struct Mode
+{
+	const char*                  p_name;
+	ThreadPool::SCHEDULING_MODES e_scheduling;
+	ThreadPool::QUEUE_BACKENDS   e_queue;
+};
+
+const Mode k_arr_modes[] =
+{
+	{ "shared/locked", ThreadPool::TP_SHARED_QUEUE,  ThreadPool::TP_QUEUE_LOCKED },
+	{ "shared/ring",   ThreadPool::TP_SHARED_QUEUE,  ThreadPool::TP_QUEUE_RING   },
+	{ "steal/locked",  ThreadPool::TP_WORK_STEALING, ThreadPool::TP_QUEUE_LOCKED },
+	{ "steal/ring",    ThreadPool::TP_WORK_STEALING, ThreadPool::TP_QUEUE_RING   },
+};
+
+std::size_t u_li_scale = 1;
+
+
+ThreadPool::Settings make_settings(const Mode& k_mode_)
+{
+	ThreadPool::Settings settings;
+
+	settings.e_scheduling = k_mode_.e_scheduling;
+	settings.e_queue = k_mode_.e_queue;
+	settings.u_li_capacity = 4096;
+
+	return settings;
+}
+
+
+double seconds_since(const Clock_t::time_point& k_start_)
+{
+	return std::chrono::duration<double>(Clock_t::now() - k_start_).count();
+}
+
+
+void report(const std::string& k_str_case_, const Mode& k_mode_, const double kd_value_, const char* kp_unit_)
+{
+	std::cout << std::left << std::setw(28) << k_str_case_ << std::setw(16) << k_mode_.p_name
+		<< std::right << std::setw(14) << std::fixed << std::setprecision(2) << kd_value_ << " " << kp_unit_ << std::endl;
+}
+
+
+// burns roughly the given time without sleeping, so the job occupies its thread
+void spin_for(const std::chrono::microseconds& k_duration_)
+{
+	const auto k_END = Clock_t::now() + k_duration_;
+
+	while (Clock_t::now() < k_END)
+	{
+	}
+}
+
+
+// empty jobs added from one thread, measures the dispatch overhead per job
+void bench_throughput(const Mode& k_mode_, const std::size_t ku_li_NTHREADS_)
+{
+	const std::size_t ku_li_NJOBS = 200000 * u_li_scale;
+	ThreadPool pool(ku_li_NTHREADS_, make_settings(k_mode_));
+
+	pool.Start_All_Threads();
+
+	const auto k_START = Clock_t::now();
+
+	for (std::size_t i = 0; i < ku_li_NJOBS; i++)
+	{
+		pool.Add_Job([](void) {});
+	}
+
+	pool.Synchronize();
+
+	report("throughput " + std::to_string(ku_li_NTHREADS_) + " threads", k_mode_, ku_li_NJOBS / seconds_since(k_START) / 1e6, "Mjobs/s");
+}
+
+
+// several producers adding jobs at once, measures the time an Add_Job call takes
+void bench_submit_latency(const Mode& k_mode_, const std::size_t ku_li_NTHREADS_)
+{
+	const std::size_t ku_li_NPRODUCERS = std::max<std::size_t>(ku_li_NTHREADS_, 2);
+	const std::size_t ku_li_NJOBS = 20000 * u_li_scale;
+	ThreadPool pool(ku_li_NTHREADS_, make_settings(k_mode_));
+	std::vector<std::vector<double>> vect_latencies(ku_li_NPRODUCERS);
+	std::vector<std::thread> vect_producers;
+	std::vector<double> vect_all;
+
+	pool.Start_All_Threads();
+
+	for (std::size_t i = 0; i < ku_li_NPRODUCERS; i++)
+	{
+		vect_producers.emplace_back([&, i](void)
+		{
+			vect_latencies[i].reserve(ku_li_NJOBS);
+
+			for (std::size_t j = 0; j < ku_li_NJOBS; j++)
+			{
+				const auto k_START = Clock_t::now();
+				pool.Add_Job([](void) {});
+				vect_latencies[i].push_back(std::chrono::duration<double, std::nano>(Clock_t::now() - k_START).count());
+			}
+		});
+	}
+
+	for (auto& thread : vect_producers)
+	{
+		thread.join();
+	}
+
+	pool.Synchronize();
+
+	for (const auto& k_vect : vect_latencies)
+	{
+		vect_all.insert(vect_all.end(), k_vect.begin(), k_vect.end());
+	}
+
+	std::sort(vect_all.begin(), vect_all.end());
+
+	report("submit p50 " + std::to_string(ku_li_NPRODUCERS) + " producers", k_mode_, vect_all[vect_all.size() / 2], "ns");
+	report("submit p99 " + std::to_string(ku_li_NPRODUCERS) + " producers", k_mode_, vect_all[vect_all.size() * 99 / 100], "ns");
+}
+
+
+// a group of tiny jobs waited for by the caller, from outside the pool and from a job of the pool
+void bench_fan_out(const Mode& k_mode_, const std::size_t ku_li_NTHREADS_)
+{
+	const std::size_t ku_li_NROUNDS = 2000 * u_li_scale;
+	const std::size_t ku_li_FAN_OUT = 64;
+	ThreadPool pool(ku_li_NTHREADS_, make_settings(k_mode_));
+	std::atomic<std::size_t> a_u_li_count(0);
+
+	pool.Start_All_Threads();
+
+	auto fan_out = [&](void)
+	{
+		ThreadPool::Task_Group group(pool);
+
+		for (std::size_t j = 0; j < ku_li_FAN_OUT; j++)
+		{
+			group.Add_Job([&](void) { a_u_li_count.fetch_add(1, std::memory_order_relaxed); });
+		}
+
+		group.Wait();
+	};
+
+	auto k_start = Clock_t::now();
+
+	for (std::size_t i = 0; i < ku_li_NROUNDS; i++)
+	{
+		fan_out();
+	}
+
+	report("fan-out 64 external", k_mode_, seconds_since(k_start) / ku_li_NROUNDS * 1e6, "us/round");
+
+	k_start = Clock_t::now();
+	pool.Add_Job([&](void)
+	{
+		for (std::size_t i = 0; i < ku_li_NROUNDS; i++)
+		{
+			fan_out();
+		}
+	});
+	pool.Synchronize();
+
+	report("fan-out 64 nested", k_mode_, seconds_since(k_start) / ku_li_NROUNDS * 1e6, "us/round");
+}
+
+
+// Synchronize on an idle pool, and right after adding a single job
+void bench_synchronize(const Mode& k_mode_, const std::size_t ku_li_NTHREADS_)
+{
+	const std::size_t ku_li_NROUNDS = 20000 * u_li_scale;
+	ThreadPool pool(ku_li_NTHREADS_, make_settings(k_mode_));
+
+	pool.Start_All_Threads();
+
+	auto k_start = Clock_t::now();
+
+	for (std::size_t i = 0; i < ku_li_NROUNDS; i++)
+	{
+		pool.Synchronize();
+	}
+
+	report("synchronize idle", k_mode_, seconds_since(k_start) / ku_li_NROUNDS * 1e9, "ns");
+
+	k_start = Clock_t::now();
+
+	for (std::size_t i = 0; i < ku_li_NROUNDS; i++)
+	{
+		pool.Add_Job([](void) {});
+		pool.Synchronize();
+	}
+
+	report("synchronize one job", k_mode_, seconds_since(k_start) / ku_li_NROUNDS * 1e6, "us");
+}
+
+
+// mostly short jobs with a few long ones, compares the time taken to the ideal time for the work
+void bench_mixed(const Mode& k_mode_, const std::size_t ku_li_NTHREADS_)
+{
+	const std::size_t ku_li_NJOBS = 20000 * u_li_scale;
+	const std::chrono::microseconds k_SHORT(1), k_LONG(200);
+	ThreadPool pool(ku_li_NTHREADS_, make_settings(k_mode_));
+	double d_work = 0;
+
+	pool.Start_All_Threads();
+
+	const auto k_START = Clock_t::now();
+
+	for (std::size_t i = 0; i < ku_li_NJOBS; i++)
+	{
+		const auto k_DURATION = i % 100 == 0 ? k_LONG : k_SHORT;
+
+		d_work += std::chrono::duration<double>(k_DURATION).count();
+		pool.Add_Job([k_DURATION](void) { spin_for(k_DURATION); });
+	}
+
+	pool.Synchronize();
+
+	report("mixed 1% long", k_mode_, seconds_since(k_START) / (d_work / ku_li_NTHREADS_), "x ideal");
+}
+
+
+// one producer for every four threads adding jobs from outside the pool, at 32 threads and more the state of the pool
+// is written from many cores at once, so producers and consumers sharing cache lines shows up as a drop in throughput
+void bench_scaling(const Mode& k_mode_, const std::size_t ku_li_NTHREADS_)
+{
+	const std::size_t ku_li_NPRODUCERS = std::max<std::size_t>(ku_li_NTHREADS_ / 4, 1);
+	const std::size_t ku_li_NJOBS = 20000 * u_li_scale;
+	ThreadPool pool(ku_li_NTHREADS_, make_settings(k_mode_));
+	std::vector<std::thread> vect_producers;
+
+	pool.Start_All_Threads();
+
+	const auto k_START = Clock_t::now();
+
+	for (std::size_t i = 0; i < ku_li_NPRODUCERS; i++)
+	{
+		vect_producers.emplace_back([&](void)
+		{
+			for (std::size_t j = 0; j < ku_li_NJOBS; j++)
+			{
+				pool.Add_Job([](void) {});
+			}
+		});
+	}
+
+	for (auto& thread : vect_producers)
+	{
+		thread.join();
+	}
+
+	pool.Synchronize();
+
+	report("scaling " + std::to_string(ku_li_NTHREADS_) + " threads", k_mode_, ku_li_NPRODUCERS * ku_li_NJOBS / seconds_since(k_START) / 1e6, "Mjobs/s");
+}
+
+
+// CPU time consumed by an idle pool, after it ran a burst of jobs
+void bench_idle_cpu(const Mode& k_mode_, const std::size_t ku_li_NTHREADS_)
+{
+	ThreadPool pool(ku_li_NTHREADS_, make_settings(k_mode_));
+
+	pool.Start_All_Threads();
+
+	for (std::size_t i = 0; i < 1000; i++)
+	{
+		pool.Add_Job([](void) {});
+	}
+
+	pool.Synchronize();
+
+	// leave the threads time to finish spinning before measuring
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	const std::clock_t k_CPU_START = std::clock();
+	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+	const std::clock_t k_CPU_END = std::clock();
+
+	report("idle cpu", k_mode_, 100.0 * (k_CPU_END - k_CPU_START) / CLOCKS_PER_SEC / 0.5, "% of a core");
+}
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t ku_li_NCORES = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+
+	if (argc > 1)
+	{
+		u_li_scale = std::max(std::atoi(argv[1]), 1);
+	}
+
+	for (const auto& k_mode : k_arr_modes)
+	{
+		for (std::size_t u_li_nthreads = 1; u_li_nthreads < ku_li_NCORES; u_li_nthreads *= 2)
+		{
+			bench_throughput(k_mode, u_li_nthreads);
+		}
+
+		bench_throughput(k_mode, ku_li_NCORES);
+		bench_submit_latency(k_mode, ku_li_NCORES);
+		bench_fan_out(k_mode, ku_li_NCORES);
+		bench_synchronize(k_mode, ku_li_NCORES);
+		bench_mixed(k_mode, ku_li_NCORES);
+		bench_idle_cpu(k_mode, ku_li_NCORES);
+
+		// oversubscribed on machines with fewer cores, results only compare between builds on the same machine
+		for (std::size_t u_li_nthreads = 32; u_li_nthreads <= std::max<std::size_t>(ku_li_NCORES, 64); u_li_nthreads *= 2)
+		{
+			bench_scaling(k_mode, u_li_nthreads);
+		}
+	}
+
+	return 0;
+}
@@ -3,6 +3,8 @@
 #include <iterator>
 #include <future>
 #include <mutex>
+#include <atomic>
+#include <vector>
 
 #include "ThreadPool.hpp"
 
@@ -17,21 +19,80 @@ int x3(int k, double l) { return int(l) * k; }
 
 auto add_heap_jobs(ThreadPool* _my_pool)
 {
-	// An example of adding jobs allocated on the heap to the thread pool
+	// An example of adding jobs that outlive the calling scope to the thread pool
 	// nothing changes for functions without return value
 	_my_pool->Add_Job([](void) {auto f1 = std::bind(test3, 1.2345, 4); f1(); });
 
-	// If there is a return value, we need to wrap the lambda in a task to get the future
-	// and then wrap the task in a lambda to delete it after we leave the scope
-	auto t = new std::packaged_task<int(void)>([](void) {auto f1 = std::bind(x3, 3, 3.14); auto res = f1(); return res; });
+	// If there is a return value, Submit wraps the function and its arguments in a task
+	// owned by the thread pool, the task is released once it was executed or discarded
 
-	// the lambda needs to get t from this scope so we can execute the task
-	// and later release the memory associated with it
-	_my_pool->Add_Job([t](void) { (*t)(); delete t; });
-
-	// we return the future associated with t to the caller 
+	// we return the future associated with the task to the caller 
 	// so they can receive the returned value
-	return t->get_future();
+	return _my_pool->Submit(x3, 3, 3.14);
+}
+
+int continuations_on_full_ring(void)
+{
+	// A regression test: the thread completing a job adds its continuation even if the ring buffer is full,
+	// while this thread holds the slots it frees to add the next jobs, so nothing would be left to take them
+	ThreadPool::Settings settings;
+	settings.e_queue = ThreadPool::TP_QUEUE_RING;
+	settings.u_li_capacity = 2;
+
+	ThreadPool pool(1, settings);
+	pool.Start_All_Threads();
+
+	std::vector<ThreadPool::Future<int>> futures;
+
+	for (int i = 0; i < 2000; i++)
+	{
+		futures.push_back(pool.Submit(x2, i).Then([](int y) { return y - 8; }));
+	}
+
+	int sum = 0;
+
+	for (auto& f : futures)
+	{
+		sum += f.get();
+	}
+
+	// the sum of 0 to 1999
+	return sum;
+}
+
+int nested_task_groups(void)
+{
+	// A regression test: jobs of the pool adding more jobs than the queue holds and waiting for them
+	// execute queued jobs while the queue is full, rather than all of them waiting for room
+	ThreadPool pool(4);
+	pool.Start_All_Threads();
+
+	std::atomic<int> count(0);
+
+	for (int round = 0; round < 3; round++)
+	{
+		ThreadPool::Task_Group outer(pool);
+
+		for (int i = 0; i < 50; i++)
+		{
+			outer.Add_Job([&](void)
+			{
+				ThreadPool::Task_Group inner(pool);
+
+				for (int j = 0; j < 50; j++)
+				{
+					inner.Add_Job([&](void) { count++; });
+				}
+
+				inner.Wait();
+			});
+		}
+
+		outer.Wait();
+	}
+
+	// 3 rounds of 50 times 50 jobs
+	return count;
 }
 
 
@@ -102,10 +163,13 @@ int main()
 	// instruct thread pool to terminate all running threads
 	// this is unnecessary here as the destructor would do this anyway on the next line
 	// however, it is recommended to do this if the threads are not needed for some time
-	// as they will still get scheduled and waste CPU cycles on context switches only 
-	// to yield the CPU if no jobs are available
+	// as parked threads do not use CPU time, but they still hold on to their resources
 	pool.Kill_All(false);
 
+	// regression tests, they use pools of their own
+	std::cout << "Continuations on a full ring: " << continuations_on_full_ring() << std::endl;
+	std::cout << "Nested task groups: " << nested_task_groups() << std::endl;
+
 	return 0;
 }
 
@@ -0,0 +1,371 @@
+#pragma once
+
+#ifndef __ARENA_HPP
+#define __ARENA_HPP
+
+#include <cstddef>      // size_t, max_align_t
+#include <cstdint>      // uintptr_t
+#include <atomic>       // atomic
+#include <new>          // operator new, align_val_t, bad_alloc
+#include <type_traits>  // true_type
+#if __has_include(<memory_resource>)
+#include <memory_resource> // memory_resource, get_default_resource
+#endif
+
+///<summary>
+/// Allocator handing out small blocks from slabs owned by one thread, blocks may be freed by any thread.
+///</summary>
+///<remarks>
+/// Blocks are rounded up to one of M_N_CLASSES size classes, every slab holds blocks of one class.
+/// Only one thread at a time may call Allocate, callers serialize allocations themselves, while
+/// <see cref="Free"/> may be called by any thread, even after the arena was destroyed. Freed blocks
+/// are pushed onto a lock-free list of their slab, which the allocating thread takes over as a whole
+/// once it runs out of blocks, so neither side ever waits for the other. Slabs are kept until the arena
+/// is destroyed, a slab still holding blocks then is returned to the upstream resource by the last free.
+/// Blocks larger than M_MAX_BLOCK_SIZE are forwarded to the upstream resource.
+///</remarks>
+class Slab_Arena
+{
+public:
+	static constexpr std::size_t M_SLAB_SIZE = std::size_t(1) << 16;
+	static constexpr std::size_t M_MIN_BLOCK_SIZE = 64;
+	static constexpr std::size_t M_N_CLASSES = 4;
+	static constexpr std::size_t M_MAX_BLOCK_SIZE = M_MIN_BLOCK_SIZE << (M_N_CLASSES - 1);
+
+#ifdef __cpp_lib_memory_resource
+	using Resource_t = std::pmr::memory_resource;
+#else
+	///<summary>
+	/// Stand-in for std::pmr::memory_resource where it is not available, allocates with the aligned global operator new.
+	///</summary>
+	class Resource_t
+	{
+	public:
+		void* allocate(const std::size_t ku_li_BYTES_, const std::size_t ku_li_ALIGNMENT_)
+		{
+			return ::operator new(ku_li_BYTES_, std::align_val_t(ku_li_ALIGNMENT_));
+		} // end method allocate
+
+		void deallocate(void* p_, const std::size_t ku_li_BYTES_, const std::size_t ku_li_ALIGNMENT_) noexcept
+		{
+			::operator delete(p_, ku_li_BYTES_, std::align_val_t(ku_li_ALIGNMENT_));
+		} // end method deallocate
+	}; // end class Resource_t
+#endif
+
+private:
+	///<summary>
+	/// A free block, linked to the next free block.
+	///</summary>
+	struct Block_t
+	{
+		Block_t* mp_next; //! the next free block, nullptr for the last one
+	}; // end struct Block_t
+
+
+	///<summary>
+	/// Header at the start of every slab, the slab of a block is found by aligning its address down.
+	///</summary>
+	struct alignas(M_MIN_BLOCK_SIZE) Slab_t
+	{
+		std::atomic<Block_t*>    ma_p_remote;   //! blocks freed since the owner last took them, written by any thread
+		std::atomic<std::size_t> ma_u_li_live;  //! the number of allocated blocks, plus M_OWNED while the arena exists
+		Resource_t*              mp_upstream;   //! the resource the slab was allocated from
+		std::size_t              mu_li_offset;  //! the offset of the first block that was never handed out, owner only
+		Slab_t*                  mp_next;       //! the next slab of the same class, owner only
+	}; // end struct Slab_t
+
+	// blocks larger than the largest class carry the resource they came from in front of them
+	static constexpr std::size_t M_HEADER_SIZE = alignof(std::max_align_t);
+	static constexpr std::size_t M_OWNED = std::size_t(1) << (sizeof(std::size_t) * 8 - 1);
+
+public:
+	// Disallow any kind of copy/move operation, blocks refer to the slabs of this arena
+	Slab_Arena(const Slab_Arena&) = delete;
+	Slab_Arena(Slab_Arena&&) = delete;
+	Slab_Arena& operator=(const Slab_Arena&) = delete;
+	Slab_Arena& operator=(Slab_Arena&&) = delete;
+
+
+	///<summary>
+	/// Initializes an arena without slabs.
+	///</summary>
+	///<param name="p_upstream_">The resource slabs and large blocks are allocated from, nullptr for <see cref="Default_Resource"/>. It must outlive all blocks.</param>
+	explicit Slab_Arena(Resource_t* p_upstream_ = nullptr) noexcept
+		: mp_upstream(p_upstream_ != nullptr ? p_upstream_ : Default_Resource())
+	{
+		for (std::size_t i = 0; i < M_N_CLASSES; i++)
+		{
+			m_arr_p_free[i] = nullptr;
+			m_arr_p_slabs[i] = nullptr;
+		} // end for i
+	} // end Constructor
+
+
+	///<summary>
+	/// Returns all slabs without allocated blocks, the remaining slabs are returned by the last free of one of their blocks.
+	///</summary>
+	~Slab_Arena(void)
+	{
+		for (auto p_slab : m_arr_p_slabs)
+		{
+			while (p_slab != nullptr)
+			{
+				Slab_t* p_next = p_slab->mp_next;
+
+				if (p_slab->ma_u_li_live.fetch_sub(M_OWNED, std::memory_order_acq_rel) == M_OWNED)
+				{
+					release(p_slab);
+				} // end if
+
+				p_slab = p_next;
+			} // end while
+		} // end for p_slab
+	} // end Destructor
+
+
+	///<summary>
+	/// Returns the resource used by arenas that are not given one, std::pmr::get_default_resource() where available.
+	///</summary>
+	static Resource_t* Default_Resource(void) noexcept
+	{
+#ifdef __cpp_lib_memory_resource
+		return std::pmr::get_default_resource();
+#else
+		static Resource_t s_resource;
+
+		return &s_resource;
+#endif
+	} // end method Default_Resource
+
+
+	///<summary>
+	/// Allocates a block of at least <paramref name="ku_li_BYTES_"/> bytes, aligned for any type of fundamental alignment.
+	/// Must only be called by one thread at a time.
+	///</summary>
+	///<param name="ku_li_BYTES_">The size of the block.</param>
+	///<returns>The block, never nullptr.</returns>
+	///<exception cref="std::bad_alloc">Thrown if the upstream resource fails to allocate.</exception>
+	void* Allocate(const std::size_t ku_li_BYTES_)
+	{
+		if (ku_li_BYTES_ > M_MAX_BLOCK_SIZE)
+		{
+			char* p_raw = static_cast<char*>(mp_upstream->allocate(ku_li_BYTES_ + M_HEADER_SIZE, alignof(std::max_align_t)));
+
+			*reinterpret_cast<Resource_t**>(p_raw) = mp_upstream;
+
+			return p_raw + M_HEADER_SIZE;
+		} // end if
+
+		const std::size_t ku_li_CLASS = size_class(ku_li_BYTES_);
+		Block_t* p_block = m_arr_p_free[ku_li_CLASS];
+
+		if (p_block == nullptr)
+		{
+			p_block = refill(ku_li_CLASS);
+		} // end if
+
+		m_arr_p_free[ku_li_CLASS] = p_block->mp_next;
+		slab_of(p_block)->ma_u_li_live.fetch_add(1, std::memory_order_relaxed);
+
+		return p_block;
+	} // end method Allocate
+
+
+	///<summary>
+	/// Frees a block allocated by any arena. May be called by any thread.
+	///</summary>
+	///<param name="p_">The block, nullptr is ignored.</param>
+	///<param name="ku_li_BYTES_">The size the block was allocated with.</param>
+	static void Free(void* p_, const std::size_t ku_li_BYTES_) noexcept
+	{
+		if (p_ == nullptr)
+		{
+			return;
+		} // end if
+
+		if (ku_li_BYTES_ > M_MAX_BLOCK_SIZE)
+		{
+			char* p_raw = static_cast<char*>(p_) - M_HEADER_SIZE;
+
+			(*reinterpret_cast<Resource_t**>(p_raw))->deallocate(p_raw, ku_li_BYTES_ + M_HEADER_SIZE, alignof(std::max_align_t));
+			return;
+		} // end if
+
+		Block_t* p_block = static_cast<Block_t*>(p_);
+		Slab_t* p_slab = slab_of(p_block);
+
+		// the owner only ever takes the whole list, so a block cannot be popped and pushed again in between
+		p_block->mp_next = p_slab->ma_p_remote.load(std::memory_order_relaxed);
+
+		while (p_slab->ma_p_remote.compare_exchange_weak(p_block->mp_next, p_block, std::memory_order_release, std::memory_order_relaxed) == false)
+		{
+		} // end while
+
+		// the slab outlived its arena and this was its last block
+		if (p_slab->ma_u_li_live.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			release(p_slab);
+		} // end if
+	} // end method Free
+
+
+	///<summary>
+	/// Accessor for the resource slabs and large blocks are allocated from.
+	///</summary>
+	Resource_t* Upstream(void) const noexcept
+	{
+		return mp_upstream;
+	} // end method Upstream
+
+
+private:
+	///<summary>
+	/// Returns the size class of blocks of <paramref name="ku_li_BYTES_"/> bytes, which must not exceed M_MAX_BLOCK_SIZE.
+	///</summary>
+	static std::size_t size_class(const std::size_t ku_li_BYTES_) noexcept
+	{
+		std::size_t u_li_class = 0;
+
+		while ((M_MIN_BLOCK_SIZE << u_li_class) < ku_li_BYTES_)
+		{
+			u_li_class++;
+		} // end while
+
+		return u_li_class;
+	} // end method size_class
+
+
+	///<summary>
+	/// Returns the slab <paramref name="p_block_"/> belongs to.
+	///</summary>
+	static Slab_t* slab_of(const Block_t* p_block_) noexcept
+	{
+		return reinterpret_cast<Slab_t*>(reinterpret_cast<std::uintptr_t>(p_block_) & ~std::uintptr_t(M_SLAB_SIZE - 1));
+	} // end method slab_of
+
+
+	///<summary>
+	/// Returns <paramref name="p_slab_"/> to the resource it was allocated from.
+	///</summary>
+	static void release(Slab_t* p_slab_) noexcept
+	{
+		Resource_t* p_upstream = p_slab_->mp_upstream;
+
+		p_slab_->~Slab_t();
+		p_upstream->deallocate(p_slab_, M_SLAB_SIZE, M_SLAB_SIZE);
+	} // end method release
+
+
+	///<summary>
+	/// Finds a free block of class <paramref name="ku_li_CLASS_"/> while the free list of the class is empty,
+	/// preferring blocks freed by other threads, then blocks never handed out, then a new slab.
+	///</summary>
+	///<returns>The first block of the new free list of the class.</returns>
+	Block_t* refill(const std::size_t ku_li_CLASS_)
+	{
+		const std::size_t ku_li_BLOCK_SIZE = M_MIN_BLOCK_SIZE << ku_li_CLASS_;
+
+		for (Slab_t* p_slab = m_arr_p_slabs[ku_li_CLASS_]; p_slab != nullptr; p_slab = p_slab->mp_next)
+		{
+			if (p_slab->ma_p_remote.load(std::memory_order_relaxed) != nullptr)
+			{
+				return m_arr_p_free[ku_li_CLASS_] = p_slab->ma_p_remote.exchange(nullptr, std::memory_order_acquire);
+			} // end if
+		} // end for p_slab
+
+		Slab_t* p_slab = m_arr_p_slabs[ku_li_CLASS_];
+
+		if (p_slab == nullptr || p_slab->mu_li_offset + ku_li_BLOCK_SIZE > M_SLAB_SIZE)
+		{
+			p_slab = ::new (mp_upstream->allocate(M_SLAB_SIZE, M_SLAB_SIZE)) Slab_t();
+			p_slab->ma_p_remote.store(nullptr, std::memory_order_relaxed);
+			p_slab->ma_u_li_live.store(M_OWNED, std::memory_order_relaxed);
+			p_slab->mp_upstream = mp_upstream;
+			p_slab->mu_li_offset = (sizeof(Slab_t) + ku_li_BLOCK_SIZE - 1) / ku_li_BLOCK_SIZE * ku_li_BLOCK_SIZE;
+			p_slab->mp_next = m_arr_p_slabs[ku_li_CLASS_];
+			m_arr_p_slabs[ku_li_CLASS_] = p_slab;
+		} // end if
+
+		// only the newest slab of a class has blocks that were never handed out
+		Block_t* p_block = reinterpret_cast<Block_t*>(reinterpret_cast<char*>(p_slab) + p_slab->mu_li_offset);
+
+		p_slab->mu_li_offset += ku_li_BLOCK_SIZE;
+		p_block->mp_next = nullptr;
+
+		return m_arr_p_free[ku_li_CLASS_] = p_block;
+	} // end method refill
+
+
+	Resource_t* mp_upstream;                    //! the resource slabs and large blocks are allocated from
+	Block_t*    m_arr_p_free[M_N_CLASSES];      //! the blocks of every class that may be handed out without synchronization
+	Slab_t*     m_arr_p_slabs[M_N_CLASSES];     //! the slabs of every class, newest first
+
+}; // end class Slab_Arena
+
+
+///<summary>
+/// Standard allocator drawing from a <see cref="Slab_Arena"/>, the caller serializes allocations as the arena requires.
+///</summary>
+///<remarks>
+/// Memory may be deallocated through any copy on any thread, even after the arena was destroyed.
+///</remarks>
+template <class T>
+class Arena_Allocator
+{
+	template <class U> friend class Arena_Allocator;
+
+public:
+	using value_type = T;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+
+	///<summary>
+	/// Initializes an allocator drawing from <paramref name="p_arena_"/>.
+	///</summary>
+	explicit Arena_Allocator(Slab_Arena* p_arena_) noexcept
+		: mp_arena(p_arena_)
+	{
+	} // end Constructor(1)
+
+
+	template <class U>
+	Arena_Allocator(const Arena_Allocator<U>& k_other_) noexcept
+		: mp_arena(k_other_.mp_arena)
+	{
+	} // end Constructor(2)
+
+
+	T* allocate(const std::size_t ku_li_N_)
+	{
+		return static_cast<T*>(mp_arena->Allocate(ku_li_N_ * sizeof(T)));
+	} // end method allocate
+
+
+	void deallocate(T* p_, const std::size_t ku_li_N_) noexcept
+	{
+		Slab_Arena::Free(p_, ku_li_N_ * sizeof(T));
+	} // end method deallocate
+
+
+	template <class U>
+	bool operator==(const Arena_Allocator<U>& k_other_) const noexcept
+	{
+		return mp_arena == k_other_.mp_arena;
+	} // end operator==
+
+
+	template <class U>
+	bool operator!=(const Arena_Allocator<U>& k_other_) const noexcept
+	{
+		return mp_arena != k_other_.mp_arena;
+	} // end operator!=
+
+
+private:
+	Slab_Arena* mp_arena; //! the arena memory is drawn from
+
+}; // end class Arena_Allocator
+
+#endif
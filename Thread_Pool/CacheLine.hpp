@@ -0,0 +1,34 @@
+#pragma once
+
+#ifndef __CACHE_LINE_HPP
+#define __CACHE_LINE_HPP
+
+#include <cstddef>      // size_t
+#include <new>          // hardware_destructive_interference_size
+
+///<summary>
+/// The cache line size the data structures of the thread pool pad and align to, so data written by different threads 
+/// doesn't share a line.
+///</summary>
+///<remarks>
+/// This is std::hardware_destructive_interference_size where the standard library provides it, and 64 bytes otherwise.
+/// The value depends on the CPU the code is tuned for, so all translation units sharing data structures of the pool 
+/// must be compiled with the same tuning flags, which GCC warns about on every use unless the warning is disabled here.
+///</remarks>
+struct Cache_Line
+{
+#ifdef __cpp_lib_hardware_interference_size
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+	static constexpr std::size_t M_SIZE = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+	static constexpr std::size_t M_SIZE = 64;
+#endif
+}; // end struct Cache_Line
+
+#endif
@@ -0,0 +1,350 @@
+#pragma once
+
+#ifndef __JOB_HPP
+#define __JOB_HPP
+
+#include <cstddef>      // size_t, max_align_t, nullptr_t
+#include <new>          // placement new
+#include <functional>   // bad_function_call
+#include <type_traits>  // decay_t, enable_if_t, is_same, is_invocable, conditional_t
+#include <utility>      // move, forward
+#include <chrono>       // steady_clock
+#ifdef THREAD_POOL_ENABLE_TRACING
+#include <cstdint>      // uint64_t
+#endif
+
+///<summary>
+/// Move-only, type-erased wrapper for a callable that takes no arguments and returns nothing.
+///</summary>
+///<remarks>
+/// Callables of up to <typeparamref name="BUFFER_SIZE"/> bytes that can be moved without
+/// throwing are stored inline in the job, larger callables are stored on the heap.
+/// Unlike std::function, the callable does not have to be copyable.
+/// If <typeparamref name="STAMPED"/> is true, every job also carries a timestamp, which is set
+/// when the job is created and again when it is added to a thread pool, otherwise the timestamp takes no space.
+/// If THREAD_POOL_ENABLE_TRACING is defined, every job also carries an optional label and the id
+/// a thread pool assigns it when tracing is on, both are moved along with the callable.
+///</remarks>
+template <std::size_t BUFFER_SIZE, bool STAMPED = false>
+class Basic_Job
+{
+	///<summary>
+	/// Stands in for the timestamp of jobs that are not stamped.
+	///</summary>
+	struct No_Stamp_t
+	{
+	}; // end struct No_Stamp_t
+
+	using Stamp_t = std::conditional_t<STAMPED, std::chrono::steady_clock::time_point, No_Stamp_t>;
+
+
+	///<summary>
+	/// Operations on the stored callable, one table exists per callable type and storage kind.
+	///</summary>
+	struct VTable
+	{
+		void (*fn_invoke)(void*);                   //! invokes the callable
+		void (*fn_move)(void*, void*) noexcept;     //! moves the callable from the second buffer into the first
+		void (*fn_destroy)(void*) noexcept;         //! destroys the callable
+	}; // end struct VTable
+
+
+	///<summary>
+	/// Operations for callables stored inside the buffer.
+	///</summary>
+	template <class F>
+	struct Inline_Ops
+	{
+		static void Invoke(void* p_buffer_)
+		{
+			(*static_cast<F*>(p_buffer_))();
+		} // end method Invoke
+
+		static void Move(void* p_dest_, void* p_src_) noexcept
+		{
+			::new (p_dest_) F(std::move(*static_cast<F*>(p_src_)));
+			static_cast<F*>(p_src_)->~F();
+		} // end method Move
+
+		static void Destroy(void* p_buffer_) noexcept
+		{
+			static_cast<F*>(p_buffer_)->~F();
+		} // end method Destroy
+
+		static constexpr VTable M_VTABLE = { &Invoke, &Move, &Destroy };
+	}; // end struct Inline_Ops
+
+
+	///<summary>
+	/// Operations for callables stored on the heap, the buffer only holds a pointer to the callable.
+	///</summary>
+	template <class F>
+	struct Heap_Ops
+	{
+		static void Invoke(void* p_buffer_)
+		{
+			(**static_cast<F**>(p_buffer_))();
+		} // end method Invoke
+
+		static void Move(void* p_dest_, void* p_src_) noexcept
+		{
+			*static_cast<F**>(p_dest_) = *static_cast<F**>(p_src_);
+		} // end method Move
+
+		static void Destroy(void* p_buffer_) noexcept
+		{
+			delete *static_cast<F**>(p_buffer_);
+		} // end method Destroy
+
+		static constexpr VTable M_VTABLE = { &Invoke, &Move, &Destroy };
+	}; // end struct Heap_Ops
+
+public:
+	static_assert(BUFFER_SIZE >= sizeof(void*), "The buffer of a job must be able to hold at least a pointer");
+
+	static constexpr std::size_t M_BUFFER_SIZE = BUFFER_SIZE;
+	static constexpr bool M_STAMPED = STAMPED;
+
+	///<summary>
+	/// Whether or not a callable of type <typeparamref name="F"/> is stored without a heap allocation.
+	///</summary>
+	template <class F>
+	static constexpr bool Fits_Inline = sizeof(F) <= BUFFER_SIZE
+		&& alignof(F) <= alignof(std::max_align_t)
+		&& std::is_nothrow_move_constructible<F>::value;
+
+
+	///<summary>
+	/// Initializes an empty job.
+	///</summary>
+	Basic_Job(void) noexcept
+		: mp_vtable(nullptr)
+	{
+	} // end Constructor(1)
+
+
+	///<summary>
+	/// Initializes an empty job.
+	///</summary>
+	Basic_Job(std::nullptr_t) noexcept
+		: mp_vtable(nullptr)
+	{
+	} // end Constructor(2)
+
+
+	///<summary>
+	/// Initializes the job to invoke <paramref name="fn_"/>.
+	///</summary>
+	///<param name="fn_">The callable to store, it is moved or copied into the job.</param>
+	template <class F, class = std::enable_if_t<std::is_same<std::decay_t<F>, Basic_Job>::value == false
+		&& std::is_invocable<std::decay_t<F>&>::value>>
+	Basic_Job(F&& fn_)
+	{
+		Stamp();
+
+		using Callable_t = std::decay_t<F>;
+
+		if constexpr (Fits_Inline<Callable_t>)
+		{
+			::new (static_cast<void*>(m_arr_buffer)) Callable_t(std::forward<F>(fn_));
+			mp_vtable = &Inline_Ops<Callable_t>::M_VTABLE;
+		} // end if
+		else
+		{
+			*reinterpret_cast<Callable_t**>(m_arr_buffer) = new Callable_t(std::forward<F>(fn_));
+			mp_vtable = &Heap_Ops<Callable_t>::M_VTABLE;
+		} // end else
+	} // end Constructor(3)
+
+
+	///<summary>
+	/// Moves the callable of <paramref name="other_"/> into this job, <paramref name="other_"/> is left empty.
+	///</summary>
+	Basic_Job(Basic_Job&& other_) noexcept
+		: mp_vtable(other_.mp_vtable)
+	{
+		if (mp_vtable != nullptr)
+		{
+			mp_vtable->fn_move(m_arr_buffer, other_.m_arr_buffer);
+			other_.mp_vtable = nullptr;
+		} // end if
+
+		m_tp_stamp = other_.m_tp_stamp;
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+		mp_label = other_.mp_label;
+		mu_li_trace_id = other_.mu_li_trace_id;
+#endif
+	} // end Move Constructor
+
+
+	Basic_Job(const Basic_Job&) = delete;
+	Basic_Job& operator=(const Basic_Job&) = delete;
+
+
+	///<summary>
+	/// Destroys the stored callable, if any.
+	///</summary>
+	~Basic_Job(void)
+	{
+		reset();
+	} // end Destructor
+
+
+	///<summary>
+	/// Destroys the stored callable and moves the callable of <paramref name="other_"/> into this job.
+	///</summary>
+	Basic_Job& operator=(Basic_Job&& other_) noexcept
+	{
+		if (this != &other_)
+		{
+			reset();
+
+			if (other_.mp_vtable != nullptr)
+			{
+				other_.mp_vtable->fn_move(m_arr_buffer, other_.m_arr_buffer);
+				mp_vtable = other_.mp_vtable;
+				other_.mp_vtable = nullptr;
+			} // end if
+
+			m_tp_stamp = other_.m_tp_stamp;
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+			mp_label = other_.mp_label;
+			mu_li_trace_id = other_.mu_li_trace_id;
+#endif
+		} // end if
+
+		return *this;
+	} // end Move Assignment
+
+
+	///<summary>
+	/// Destroys the stored callable, leaving the job empty.
+	///</summary>
+	Basic_Job& operator=(std::nullptr_t) noexcept
+	{
+		reset();
+
+		return *this;
+	} // end Assignment
+
+
+	///<summary>
+	/// Invokes the stored callable.
+	///</summary>
+	///<exception cref="std::bad_function_call">Thrown if the job is empty.</exception>
+	void operator()(void)
+	{
+		if (mp_vtable == nullptr)
+		{
+			throw std::bad_function_call();
+		} // end if
+
+		mp_vtable->fn_invoke(m_arr_buffer);
+	} // end operator()
+
+
+	///<summary>
+	/// Returns whether or not the job stores a callable.
+	///</summary>
+	explicit operator bool(void) const noexcept
+	{
+		return mp_vtable != nullptr;
+	} // end operator bool
+
+
+	///<summary>
+	/// Sets the timestamp of the job to the current time, does nothing if jobs are not stamped.
+	///</summary>
+	void Stamp(void) noexcept
+	{
+		if constexpr (STAMPED == true)
+		{
+			m_tp_stamp = std::chrono::steady_clock::now();
+		} // end if
+	} // end method Stamp
+
+
+	///<summary>
+	/// Accessor for the time the job was last stamped, only available if jobs are stamped.
+	///</summary>
+	///<returns>The timestamp of the job.</returns>
+	std::chrono::steady_clock::time_point Timestamp(void) const noexcept
+	{
+		static_assert(STAMPED == true, "Only stamped jobs have a timestamp");
+
+		return m_tp_stamp;
+	} // end method Timestamp
+
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+	///<summary>
+	/// Sets the label the job is shown with in traces.
+	///</summary>
+	///<param name="kp_LABEL_">The label, the string is not copied and has to outlive every trace the job appears in, usually a literal.</param>
+	void Set_Label(const char* kp_LABEL_) noexcept
+	{
+		mp_label = kp_LABEL_;
+	} // end method Set_Label
+
+
+	///<summary>
+	/// Accessor for the label of the job.
+	///</summary>
+	///<returns>The label of the job, nullptr if it has none.</returns>
+	const char* Label(void) const noexcept
+	{
+		return mp_label;
+	} // end method Label
+
+
+	///<summary>
+	/// Sets the id that identifies the job in traces.
+	///</summary>
+	void Set_Trace_Id(const std::uint64_t ku_li_ID_) noexcept
+	{
+		mu_li_trace_id = ku_li_ID_;
+	} // end method Set_Trace_Id
+
+
+	///<summary>
+	/// Accessor for the id that identifies the job in traces.
+	///</summary>
+	///<returns>The id of the job, 0 if it was not added to a pool while tracing was on.</returns>
+	std::uint64_t Trace_Id(void) const noexcept
+	{
+		return mu_li_trace_id;
+	} // end method Trace_Id
+#endif
+
+
+private:
+	///<summary>
+	/// Destroys the stored callable, if any.
+	///</summary>
+	void reset(void) noexcept
+	{
+		if (mp_vtable != nullptr)
+		{
+			mp_vtable->fn_destroy(m_arr_buffer);
+			mp_vtable = nullptr;
+		} // end if
+	} // end method reset
+
+
+	alignas(std::max_align_t) unsigned char m_arr_buffer[BUFFER_SIZE]; //! storage for the callable or a pointer to it
+	const VTable*                           mp_vtable;                  //! operations on the stored callable, nullptr if empty
+#if __has_cpp_attribute(no_unique_address)
+	[[no_unique_address]] Stamp_t           m_tp_stamp;                 //! the time the job was created or added to a pool, empty if jobs are not stamped
+#else
+	Stamp_t                                 m_tp_stamp;                 //! the time the job was created or added to a pool, empty if jobs are not stamped
+#endif
+#ifdef THREAD_POOL_ENABLE_TRACING
+	const char*                             mp_label = nullptr;         //! the label of the job in traces, nullptr if none
+	std::uint64_t                           mu_li_trace_id = 0;         //! the id of the job in traces, 0 if none
+#endif
+
+}; // end class Basic_Job
+
+#endif
@@ -0,0 +1,132 @@
+#pragma once
+
+#ifndef __MPSC_QUEUE_HPP
+#define __MPSC_QUEUE_HPP
+
+#include <cstddef>      // size_t
+#include <atomic>       // atomic
+#include <utility>      // move
+
+#include "CacheLine.hpp"
+
+///<summary>
+/// Unbounded lock-free multi producer, single consumer queue as described by Dmitry Vyukov.
+///</summary>
+///<remarks>
+/// Producers link a new node with a single exchange and never wait for each other or the consumer.
+/// Only one thread at a time may call Try_Pop and Empty, callers serialize consumers themselves.
+/// A pushed element becomes visible to the consumer once its producer has linked the node,
+/// so an element may briefly be invisible if its producer is preempted in between.
+/// <typeparamref name="T"/> must be default constructible, the queue always holds one node without an element.
+/// The ends are aligned to <typeparamref name="CACHE_LINE_SIZE"/> bytes.
+///</remarks>
+template <class T, std::size_t CACHE_LINE_SIZE = Cache_Line::M_SIZE>
+class MPSC_Queue
+{
+	///<summary>
+	/// A node of the queue.
+	///</summary>
+	struct Node
+	{
+		std::atomic<Node*> ma_p_next; //! the next node, nullptr for the newest node
+		T                  m_item;    //! the element, default constructed for the node without an element
+
+		Node(void)
+			: ma_p_next(nullptr), m_item()
+		{
+		} // end Constructor(1)
+
+		explicit Node(T&& item_)
+			: ma_p_next(nullptr), m_item(std::move(item_))
+		{
+		} // end Constructor(2)
+	}; // end struct Node
+
+public:
+	// Disallow any kind of copy/move operation, other threads may be accessing the queue
+	MPSC_Queue(const MPSC_Queue&) = delete;
+	MPSC_Queue(MPSC_Queue&&) = delete;
+	MPSC_Queue& operator=(const MPSC_Queue&) = delete;
+	MPSC_Queue& operator=(MPSC_Queue&&) = delete;
+
+
+	///<summary>
+	/// Initializes an empty queue.
+	///</summary>
+	MPSC_Queue(void)
+		: mp_tail(new Node())
+	{
+		ma_p_head.store(mp_tail, std::memory_order_relaxed);
+	} // end Constructor
+
+
+	///<summary>
+	/// Destroys all elements remaining in the queue.
+	///</summary>
+	~MPSC_Queue(void)
+	{
+		while (mp_tail != nullptr)
+		{
+			Node* p_next = mp_tail->ma_p_next.load(std::memory_order_relaxed);
+
+			delete mp_tail;
+			mp_tail = p_next;
+		} // end while
+	} // end Destructor
+
+
+	///<summary>
+	/// Adds <paramref name="item_"/> to the end of the queue. May be called by any thread.
+	///</summary>
+	///<param name="item_">The element to add.</param>
+	void Push(T item_)
+	{
+		Node* p_node = new Node(std::move(item_));
+		Node* p_prev = ma_p_head.exchange(p_node, std::memory_order_acq_rel);
+
+		p_prev->ma_p_next.store(p_node, std::memory_order_release);
+	} // end method Push
+
+
+	///<summary>
+	/// Attempts to remove the element at the front of the queue. Must only be called by one thread at a time.
+	///</summary>
+	///<param name="item_">Receives the removed element.</param>
+	///<returns>True if an element was removed, false if no element was visible.</returns>
+	bool Try_Pop(T& item_)
+	{
+		Node* p_next = mp_tail->ma_p_next.load(std::memory_order_acquire);
+
+		if (p_next == nullptr)
+		{
+			return false;
+		} // end if
+
+		// the next node becomes the node without an element
+		item_ = std::move(p_next->m_item);
+		p_next->m_item = T();
+
+		delete mp_tail;
+		mp_tail = p_next;
+
+		return true;
+	} // end method Try_Pop
+
+
+	///<summary>
+	/// Returns whether or not any element was visible at the time of invocation. Must only be called by one thread at a time.
+	///</summary>
+	///<returns>True iff no element can be removed.</returns>
+	bool Empty(void) const noexcept
+	{
+		return mp_tail->ma_p_next.load(std::memory_order_acquire) == nullptr;
+	} // end method Empty
+
+
+private:
+	alignas(CACHE_LINE_SIZE) std::atomic<Node*> ma_p_head; //! the newest node, written by producers
+	alignas(CACHE_LINE_SIZE) Node*              mp_tail;   //! the node without an element, the oldest element follows it, owned by the consumer
+
+}; // end class MPSC_Queue
+
+#endif
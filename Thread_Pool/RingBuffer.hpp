@@ -0,0 +1,276 @@
+#pragma once
+
+#ifndef __RING_BUFFER_HPP
+#define __RING_BUFFER_HPP
+
+#include <cstddef>      // size_t
+#include <cstdint>      // intptr_t
+#include <atomic>       // atomic
+#include <algorithm>    // min
+#include <thread>       // yield
+#include <memory>       // unique_ptr
+#include <new>          // placement new
+#include <utility>      // move
+
+#include "CacheLine.hpp"
+
+///<summary>
+/// Bounded lock-free multi producer, multi consumer queue as described by Dmitry Vyukov.
+///</summary>
+///<remarks>
+/// All slots are allocated when the queue is initialized, pushing and popping never allocates.
+/// Every slot carries a sequence number telling producers and consumers whether the slot is
+/// free or holds an element for the current lap, so neither side ever takes a lock.
+/// Slots and indices are aligned to <typeparamref name="CACHE_LINE_SIZE"/> bytes.
+///</remarks>
+template <class T, std::size_t CACHE_LINE_SIZE = Cache_Line::M_SIZE>
+class Ring_Buffer
+{
+public:
+	static constexpr std::size_t M_CACHE_LINE_SIZE = CACHE_LINE_SIZE;
+
+private:
+	///<summary>
+	/// A slot of the queue, padded to a cache line so neighbouring slots don't share a line.
+	///</summary>
+	struct alignas(M_CACHE_LINE_SIZE) Cell
+	{
+		std::atomic<std::size_t>       ma_u_li_sequence;           //! the lap the slot is ready for
+		alignas(T) unsigned char       m_arr_storage[sizeof(T)];   //! storage for the element
+
+		T* Element(void) noexcept
+		{
+			return reinterpret_cast<T*>(m_arr_storage);
+		} // end method Element
+	}; // end struct Cell
+
+public:
+	// Disallow any kind of copy/move operation, other threads may be accessing the queue
+	Ring_Buffer(const Ring_Buffer&) = delete;
+	Ring_Buffer(Ring_Buffer&&) = delete;
+	Ring_Buffer& operator=(const Ring_Buffer&) = delete;
+	Ring_Buffer& operator=(Ring_Buffer&&) = delete;
+
+
+	///<summary>
+	/// Initializes an empty queue with room for at least <paramref name="ku_li_CAPACITY_"/> elements.
+	///</summary>
+	///<param name="ku_li_CAPACITY_">The minimum capacity, rounded up to the next power of two.</param>
+	explicit Ring_Buffer(const std::size_t ku_li_CAPACITY_)
+		: ma_u_li_enqueue(0), ma_u_li_dequeue(0)
+	{
+		std::size_t u_li_capacity = 2;
+
+		while (u_li_capacity < ku_li_CAPACITY_)
+		{
+			u_li_capacity *= 2;
+		} // end while
+
+		mu_li_mask = u_li_capacity - 1;
+		m_arr_cells.reset(new Cell[u_li_capacity]);
+
+		for (std::size_t i = 0; i < u_li_capacity; i++)
+		{
+			m_arr_cells[i].ma_u_li_sequence.store(i, std::memory_order_relaxed);
+		} // end for i
+	} // end Constructor
+
+
+	///<summary>
+	/// Destroys all elements remaining in the queue.
+	///</summary>
+	~Ring_Buffer(void)
+	{
+		T item;
+
+		while (Try_Pop(item) == true)
+		{
+		} // end while
+	} // end Destructor
+
+
+	///<summary>
+	/// Attempts to add <paramref name="item_"/> to the end of the queue without blocking.
+	///</summary>
+	///<param name="item_">The element to add, it is only moved from if the call succeeds.</param>
+	///<returns>True if the element was added, false if the queue was full.</returns>
+	bool Try_Push(T& item_)
+	{
+		std::size_t u_li_pos = ma_u_li_enqueue.load(std::memory_order_relaxed);
+		Cell* p_cell = nullptr;
+
+		while (true)
+		{
+			p_cell = &m_arr_cells[u_li_pos & mu_li_mask];
+
+			const std::size_t ku_li_SEQUENCE = p_cell->ma_u_li_sequence.load(std::memory_order_acquire);
+			const std::intptr_t ki_DIFF = static_cast<std::intptr_t>(ku_li_SEQUENCE) - static_cast<std::intptr_t>(u_li_pos);
+
+			if (ki_DIFF == 0)
+			{
+				// the slot is free for this lap, try to claim it
+				if (ma_u_li_enqueue.compare_exchange_weak(u_li_pos, u_li_pos + 1, std::memory_order_relaxed) == true)
+				{
+					break;
+				} // end if
+			} // end if
+			else if (ki_DIFF < 0)
+			{
+				// the slot still holds an element of the previous lap
+				return false;
+			} // end elif
+			else
+			{
+				// another producer claimed the slot
+				u_li_pos = ma_u_li_enqueue.load(std::memory_order_relaxed);
+			} // end else
+		} // end while
+
+		::new (static_cast<void*>(p_cell->m_arr_storage)) T(std::move(item_));
+		p_cell->ma_u_li_sequence.store(u_li_pos + 1, std::memory_order_release);
+
+		return true;
+	} // end method Try_Push
+
+
+	///<summary>
+	/// Attempts to add up to <paramref name="ku_li_COUNT_"/> elements starting at <paramref name="first_"/>
+	/// to the end of the queue, reserving the slots for all of them at once.
+	///</summary>
+	///<param name="first_">
+	/// Iterator to the first element to add, it is advanced past the last element that was added.
+	/// Every added element is moved from and used to construct an element of the queue.
+	///</param>
+	///<param name="ku_li_COUNT_">The number of elements to add.</param>
+	///<returns>The number of elements added, which is less than requested if the queue is too full.</returns>
+	///<remarks>
+	/// Slots are only reserved once the consumers have claimed all elements of the previous lap
+	/// stored in them, a consumer that is still moving such an element out is briefly waited for.
+	///</remarks>
+	template <class It>
+	std::size_t Try_Push_Bulk(It& first_, const std::size_t ku_li_COUNT_)
+	{
+		std::size_t u_li_pos = ma_u_li_enqueue.load(std::memory_order_relaxed);
+		std::size_t u_li_count = 0;
+
+		if (ku_li_COUNT_ == 0)
+		{
+			return 0;
+		} // end if
+
+		do
+		{
+			const std::size_t ku_li_DEQUEUE = ma_u_li_dequeue.load(std::memory_order_acquire);
+
+			if (ku_li_DEQUEUE > u_li_pos)
+			{
+				// the enqueue position is outdated
+				u_li_pos = ma_u_li_enqueue.load(std::memory_order_relaxed);
+				u_li_count = 0;
+				continue;
+			} // end if
+
+			const std::size_t ku_li_USED = u_li_pos - ku_li_DEQUEUE;
+
+			if (ku_li_USED >= Capacity())
+			{
+				return 0;
+			} // end if
+
+			u_li_count = std::min(ku_li_COUNT_, Capacity() - ku_li_USED);
+		} while (u_li_count == 0 || ma_u_li_enqueue.compare_exchange_weak(u_li_pos, u_li_pos + u_li_count, std::memory_order_relaxed) == false);
+
+		for (std::size_t i = 0; i < u_li_count; i++, ++first_)
+		{
+			Cell* p_cell = &m_arr_cells[(u_li_pos + i) & mu_li_mask];
+
+			while (p_cell->ma_u_li_sequence.load(std::memory_order_acquire) != u_li_pos + i)
+			{
+				std::this_thread::yield();
+			} // end while
+
+			::new (static_cast<void*>(p_cell->m_arr_storage)) T(std::move(*first_));
+			p_cell->ma_u_li_sequence.store(u_li_pos + i + 1, std::memory_order_release);
+		} // end for i
+
+		return u_li_count;
+	} // end method Try_Push_Bulk
+
+
+	///<summary>
+	/// Attempts to remove the element at the front of the queue without blocking.
+	///</summary>
+	///<param name="item_">Receives the removed element.</param>
+	///<returns>True if an element was removed, false if the queue was empty.</returns>
+	bool Try_Pop(T& item_)
+	{
+		std::size_t u_li_pos = ma_u_li_dequeue.load(std::memory_order_relaxed);
+		Cell* p_cell = nullptr;
+
+		while (true)
+		{
+			p_cell = &m_arr_cells[u_li_pos & mu_li_mask];
+
+			const std::size_t ku_li_SEQUENCE = p_cell->ma_u_li_sequence.load(std::memory_order_acquire);
+			const std::intptr_t ki_DIFF = static_cast<std::intptr_t>(ku_li_SEQUENCE) - static_cast<std::intptr_t>(u_li_pos + 1);
+
+			if (ki_DIFF == 0)
+			{
+				// the slot holds an element of this lap, try to claim it
+				if (ma_u_li_dequeue.compare_exchange_weak(u_li_pos, u_li_pos + 1, std::memory_order_relaxed) == true)
+				{
+					break;
+				} // end if
+			} // end if
+			else if (ki_DIFF < 0)
+			{
+				// the slot has not been written yet
+				return false;
+			} // end elif
+			else
+			{
+				// another consumer claimed the slot
+				u_li_pos = ma_u_li_dequeue.load(std::memory_order_relaxed);
+			} // end else
+		} // end while
+
+		item_ = std::move(*p_cell->Element());
+		p_cell->Element()->~T();
+		p_cell->ma_u_li_sequence.store(u_li_pos + mu_li_mask + 1, std::memory_order_release);
+
+		return true;
+	} // end method Try_Pop
+
+
+	///<summary>
+	/// Returns the number of elements in the queue at the time of invocation.
+	///</summary>
+	///<returns>The approximate number of elements in the queue.</returns>
+	std::size_t Size(void) const noexcept
+	{
+		const std::size_t ku_li_DEQUEUE = ma_u_li_dequeue.load(std::memory_order_relaxed);
+		const std::size_t ku_li_ENQUEUE = ma_u_li_enqueue.load(std::memory_order_relaxed);
+
+		return ku_li_ENQUEUE > ku_li_DEQUEUE ? ku_li_ENQUEUE - ku_li_DEQUEUE : 0;
+	} // end method Size
+
+
+	///<summary>
+	/// Accessor for the number of slots of the queue.
+	///</summary>
+	///<returns>The maximum number of elements the queue can hold.</returns>
+	std::size_t Capacity(void) const noexcept
+	{
+		return mu_li_mask + 1;
+	} // end method Capacity
+
+
+private:
+	alignas(M_CACHE_LINE_SIZE) std::atomic<std::size_t> ma_u_li_enqueue; //! the next position to write to, shared by producers
+	alignas(M_CACHE_LINE_SIZE) std::atomic<std::size_t> ma_u_li_dequeue; //! the next position to read from, shared by consumers
+	alignas(M_CACHE_LINE_SIZE) std::size_t              mu_li_mask;      //! mask used to map positions onto slots
+	std::unique_ptr<Cell[]>                             m_arr_cells;     //! the slots
+
+}; // end class Ring_Buffer
+
+#endif
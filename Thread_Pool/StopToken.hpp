@@ -0,0 +1,110 @@
+#pragma once
+
+#ifndef __STOP_TOKEN_HPP
+#define __STOP_TOKEN_HPP
+
+#include <atomic>       // atomic
+#include <memory>       // shared_ptr, make_shared
+#include <utility>      // move
+
+class Stop_Source;
+
+///<summary>
+/// Read-only view of the stop state of a <see cref="Stop_Source"/>, modelled after std::stop_token.
+///</summary>
+///<remarks>
+/// Tokens are cheap to copy, all copies observe the same state. A default constructed token never observes a stop request.
+///</remarks>
+class Stop_Token
+{
+public:
+	///<summary>
+	/// Initializes a token without a stop state.
+	///</summary>
+	Stop_Token(void) noexcept = default;
+
+
+	///<summary>
+	/// Returns whether or not a stop was requested through the source of this token.
+	///</summary>
+	bool Stop_Requested(void) const noexcept
+	{
+		return mp_state != nullptr && mp_state->load(std::memory_order_acquire) == true;
+	} // end method Stop_Requested
+
+
+	///<summary>
+	/// Returns whether or not this token has a stop state, that is whether a stop can ever be requested.
+	///</summary>
+	bool Stop_Possible(void) const noexcept
+	{
+		return mp_state != nullptr;
+	} // end method Stop_Possible
+
+
+private:
+	friend class Stop_Source;
+
+	explicit Stop_Token(std::shared_ptr<const std::atomic<bool>> p_state_) noexcept
+		: mp_state(std::move(p_state_))
+	{
+	} // end Constructor(2)
+
+	std::shared_ptr<const std::atomic<bool>> mp_state; //! the stop state, nullptr if none
+
+}; // end class Stop_Token
+
+
+///<summary>
+/// Owner of a stop state that stop requests are made through, modelled after std::stop_source.
+///</summary>
+///<remarks>
+/// Sources are cheap to copy, all copies and the tokens obtained from them share the same state.
+/// A stop can only be requested once, and is never reset.
+///</remarks>
+class Stop_Source
+{
+public:
+	///<summary>
+	/// Initializes a source with a new stop state.
+	///</summary>
+	Stop_Source(void)
+		: mp_state(std::make_shared<std::atomic<bool>>(false))
+	{
+	} // end Constructor
+
+
+	///<summary>
+	/// Requests a stop, all tokens of this source observe it from now on.
+	///</summary>
+	///<returns>True if this call made the request, false if a stop was requested before.</returns>
+	bool Request_Stop(void) noexcept
+	{
+		return mp_state->exchange(true, std::memory_order_acq_rel) == false;
+	} // end method Request_Stop
+
+
+	///<summary>
+	/// Returns whether or not a stop was requested.
+	///</summary>
+	bool Stop_Requested(void) const noexcept
+	{
+		return mp_state->load(std::memory_order_acquire);
+	} // end method Stop_Requested
+
+
+	///<summary>
+	/// Returns a token observing the stop state of this source.
+	///</summary>
+	Stop_Token Get_Token(void) const noexcept
+	{
+		return Stop_Token(mp_state);
+	} // end method Get_Token
+
+
+private:
+	std::shared_ptr<std::atomic<bool>> mp_state; //! the stop state
+
+}; // end class Stop_Source
+
+#endif
@@ -0,0 +1,267 @@
+#pragma once
+
+#ifndef __TASK_HPP
+#define __TASK_HPP
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>    // coroutine_handle, suspend_always, noop_coroutine
+#endif
+
+#ifdef __cpp_lib_coroutine
+#include <exception>    // exception_ptr, current_exception, rethrow_exception
+#include <functional>   // reference_wrapper
+#include <optional>     // optional
+#include <stdexcept>    // logic_error
+#include <type_traits>  // conditional_t, is_void, is_lvalue_reference
+#include <utility>      // move, exchange, forward
+
+///<summary>
+/// Lazily started coroutine producing a result of type <typeparamref name="T"/>.
+///</summary>
+///<remarks>
+/// The coroutine does not run before the task is awaited. Awaiting the task transfers control to the coroutine without
+/// going through any queue, and once the coroutine completes, control transfers back to the awaiting coroutine on
+/// whichever thread completed it, so no thread blocks while the result is pending. Exceptions escaping the coroutine are
+/// rethrown to the awaiting coroutine. The task owns the coroutine frame and destroys it with the task, a task
+/// must therefore not be destroyed while its coroutine is suspended somewhere else than at its start.
+///</remarks>
+template <class T = void>
+class Task
+{
+	///<summary>
+	/// Awaiter resuming the awaiting coroutine once the coroutine of the task completes.
+	///</summary>
+	struct Final_Awaiter_t
+	{
+		bool await_ready(void) const noexcept
+		{
+			return false;
+		} // end method await_ready
+
+		template <class Promise>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle_) const noexcept
+		{
+			std::coroutine_handle<> handle_continuation = handle_.promise().m_handle_continuation;
+
+			return handle_continuation ? handle_continuation : std::noop_coroutine();
+		} // end method await_suspend
+
+		void await_resume(void) const noexcept
+		{
+		} // end method await_resume
+	}; // end struct Final_Awaiter_t
+
+
+	///<summary>
+	/// Part of the promise shared by tasks with and without results.
+	///</summary>
+	struct Promise_Base_t
+	{
+		std::coroutine_handle<> m_handle_continuation; //! the coroutine awaiting the task
+		std::exception_ptr      m_exptr;               //! the exception that escaped the coroutine, if any
+
+		std::suspend_always initial_suspend(void) const noexcept
+		{
+			return {};
+		} // end method initial_suspend
+
+		Final_Awaiter_t final_suspend(void) const noexcept
+		{
+			return {};
+		} // end method final_suspend
+
+		void unhandled_exception(void) noexcept
+		{
+			m_exptr = std::current_exception();
+		} // end method unhandled_exception
+	}; // end struct Promise_Base_t
+
+
+	///<summary>
+	/// Promise of a task with a result, references are stored as reference wrappers.
+	///</summary>
+	struct Value_Promise_t : Promise_Base_t
+	{
+		using Value_t = std::conditional_t<std::is_lvalue_reference<T>::value, std::reference_wrapper<std::remove_reference_t<T>>, T>;
+
+		std::optional<Value_t> m_opt_value; //! the result, once the coroutine returned
+
+		template <class V = T>
+		void return_value(V&& value_)
+		{
+			m_opt_value.emplace(std::forward<V>(value_));
+		} // end method return_value
+
+		T Result(void)
+		{
+			if (this->m_exptr)
+			{
+				std::rethrow_exception(this->m_exptr);
+			} // end if
+
+			if constexpr (std::is_lvalue_reference<T>::value == true)
+			{
+				return m_opt_value->get();
+			} // end if
+			else
+			{
+				return std::move(*m_opt_value);
+			} // end else
+		} // end method Result
+	}; // end struct Value_Promise_t
+
+
+	///<summary>
+	/// Promise of a task without a result.
+	///</summary>
+	struct Void_Promise_t : Promise_Base_t
+	{
+		void return_void(void) const noexcept
+		{
+		} // end method return_void
+
+		void Result(void)
+		{
+			if (this->m_exptr)
+			{
+				std::rethrow_exception(this->m_exptr);
+			} // end if
+		} // end method Result
+	}; // end struct Void_Promise_t
+
+public:
+	///<summary>
+	/// The promise of the coroutine, as required by the language.
+	///</summary>
+	struct promise_type : std::conditional_t<std::is_void<T>::value, Void_Promise_t, Value_Promise_t>
+	{
+		Task get_return_object(void) noexcept
+		{
+			return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+		} // end method get_return_object
+	}; // end struct promise_type
+
+
+	///<summary>
+	/// Awaiter starting the coroutine of a task and returning its result.
+	///</summary>
+	struct Awaiter
+	{
+		std::coroutine_handle<promise_type> m_handle; //! the coroutine of the awaited task
+
+		// a task without a coroutine is not suspended on, await_resume throws instead
+		bool await_ready(void) const noexcept
+		{
+			return !m_handle || m_handle.done();
+		} // end method await_ready
+
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<> handle_awaiting_) const noexcept
+		{
+			m_handle.promise().m_handle_continuation = handle_awaiting_;
+
+			return m_handle;
+		} // end method await_suspend
+
+		T await_resume(void) const
+		{
+			if (!m_handle)
+			{
+				throw std::logic_error("Task has no coroutine");
+			} // end if
+
+			return m_handle.promise().Result();
+		} // end method await_resume
+	}; // end struct Awaiter
+
+
+	// Disallow copying, the task owns its coroutine
+	Task(const Task&) = delete;
+	Task& operator=(const Task&) = delete;
+
+
+	///<summary>
+	/// Initializes a task without a coroutine.
+	///</summary>
+	Task(void) noexcept = default;
+
+
+	///<summary>
+	/// Takes the coroutine of <paramref name="other_"/>, which is left without a coroutine.
+	///</summary>
+	Task(Task&& other_) noexcept
+		: m_handle(std::exchange(other_.m_handle, nullptr))
+	{
+	} // end Constructor(2)
+
+
+	///<summary>
+	/// Destroys the coroutine of this task and takes the coroutine of <paramref name="other_"/>.
+	///</summary>
+	Task& operator=(Task&& other_) noexcept
+	{
+		if (this != &other_)
+		{
+			reset();
+			m_handle = std::exchange(other_.m_handle, nullptr);
+		} // end if
+
+		return *this;
+	} // end operator=
+
+
+	///<summary>
+	/// Destroys the coroutine of this task.
+	///</summary>
+	~Task(void)
+	{
+		reset();
+	} // end Destructor
+
+
+	///<summary>
+	/// Returns whether or not the coroutine of this task has completed.
+	///</summary>
+	///<returns>True if the task has a coroutine that has completed.</returns>
+	bool Done(void) const noexcept
+	{
+		return m_handle && m_handle.done();
+	} // end method Done
+
+
+	///<summary>
+	/// Starts the coroutine of this task, the awaiting coroutine is resumed once it completes.
+	///</summary>
+	///<exception cref="std::logic_error">Thrown by the await if the task has no coroutine.</exception>
+	Awaiter operator co_await(void) const noexcept
+	{
+		return Awaiter{ m_handle };
+	} // end operator co_await
+
+
+private:
+	explicit Task(std::coroutine_handle<promise_type> handle_) noexcept
+		: m_handle(handle_)
+	{
+	} // end Constructor(3)
+
+
+	///<summary>
+	/// Destroys the coroutine of this task, if any.
+	///</summary>
+	void reset(void) noexcept
+	{
+		if (m_handle)
+		{
+			m_handle.destroy();
+			m_handle = nullptr;
+		} // end if
+	} // end method reset
+
+
+	std::coroutine_handle<promise_type> m_handle; //! the coroutine of this task, nullptr if none
+
+}; // end class Task
+
+#endif
+
+#endif
@@ -4,23 +4,55 @@
 #define __THREAD_POOL_HPP
 
 #include <cstddef>      // size_t
+#include <cstdint>      // uint32_t
 #include <thread>		// thread
+#include <chrono>       // steady_clock, duration, time_point
 #include <vector>		// vector
-#include <mutex>		// mutex, lock_guard
+#include <mutex>		// mutex, lock_guard, unique_lock, once_flag, call_once
+#include <condition_variable> // condition_variable
+#include <atomic>       // atomic
+#include <algorithm>    // for_each, min, max
+#include <functional>   // function
+#include <memory>       // unique_ptr
+#include <tuple>        // tuple, apply
+#include <utility>      // pair, exchange
+#include <optional>     // optional
+#include <iterator>     // distance, iterator_traits
+#include <type_traits>  // invoke_result_t, decay_t
 #include <iostream>		// cout
 #include <queue>		// queue
-#include <future>		// packaged_task
+#include <string>       // string
+#include <deque>        // deque
+#include <future>		// future, promise, future_error, future_status
+#include <initializer_list> // initializer_list
 #include <stdexcept>    // exception
 #include <exception>    // exception_ptr
+#include <new>          // bad_alloc
+#include <typeinfo>     // type_info, bad_cast
+#if __has_include(<span>)
+#include <span>         // span
+#endif
 
-class ThreadPool
-{
-	using Guard_t = std::lock_guard<std::mutex>;
-	constexpr std::size_t M_MAX_JOB_COUNT = 1000;
+#include "CacheLine.hpp"
+#include "Job.hpp"
+#include "RingBuffer.hpp"
+#include "WorkStealingDeque.hpp"
+#include "MPSCQueue.hpp"
+#include "Arena.hpp"
+#include "TimerWheel.hpp"
+#include "Task.hpp"
+#include "StopToken.hpp"
+#include "Topology.hpp"
+#ifdef THREAD_POOL_ENABLE_TRACING
+#include "TraceBuffer.hpp"
+#endif
 
+///<summary>
+/// The enumerations of <see cref="BasicThreadPool"/>, shared by all of its configurations.
+///</summary>
+class Thread_Pool_Base
+{
 public:
-	using Job_t = std::function<void(void)>;
-
 	enum THREAD_SIGNALS
 	{
 		TP_STARTING,
@@ -30,435 +62,6393 @@ public:
 		TP_TERMINATING
 	}; // end enum THREAD_SIGNALS
 
-	// Disallow any kind of copy/move operation on thread pools
-	ThreadPool(const ThreadPool&) = delete;
-	ThreadPool(ThreadPool&&) = delete;
-	ThreadPool& operator=(const ThreadPool&) = delete;
-	ThreadPool& operator=(ThreadPool&&) = delete;
+	enum SCHEDULING_MODES
+	{
+		TP_SHARED_QUEUE,  // all jobs are added to one queue shared by all threads
+		TP_WORK_STEALING  // jobs added by a thread of the pool go to that thread's deque, idle threads steal
+	}; // end enum SCHEDULING_MODES
+
+	enum QUEUE_BACKENDS
+	{
+		TP_QUEUE_LOCKED,  // the shared queue is an unbounded std::queue protected by a mutex
+		TP_QUEUE_RING,    // the shared queue is a preallocated lock-free ring buffer
+		TP_QUEUE_ANY      // configurations only, the backend is selected by Settings::e_queue
+	}; // end enum QUEUE_BACKENDS
+
+	enum JOB_PRIORITIES
+	{
+		TP_PRIORITY_HIGH,   // latency critical jobs, taken before all other jobs
+		TP_PRIORITY_NORMAL, // the default priority
+		TP_PRIORITY_LOW,    // background jobs, only taken when no other jobs are queued or to prevent starvation
+		TP_N_PRIORITIES
+	}; // end enum JOB_PRIORITIES
+
+	enum AFFINITY_MODES
+	{
+		TP_AFFINITY_NONE,     // threads are not pinned, the operating system decides where they run
+		TP_AFFINITY_COMPACT,  // thread i is pinned to the i-th CPU, filling one NUMA node before the next
+		TP_AFFINITY_SCATTER,  // threads are pinned round robin across NUMA nodes
+		TP_AFFINITY_EXPLICIT  // thread i is pinned to Settings::vect_cpus[i % size]
+	}; // end enum AFFINITY_MODES
+
+	enum SHUTDOWN_POLICIES
+	{
+		TP_SHUTDOWN_DRAIN,    // all pending jobs are executed before the threads terminate
+		TP_SHUTDOWN_CANCEL,   // pending jobs are discarded, jobs already executing are completed
+		TP_SHUTDOWN_DEADLINE  // pending jobs are executed until a deadline, the remaining jobs are discarded
+	}; // end enum SHUTDOWN_POLICIES
+
+	enum IDLE_STRATEGIES
+	{
+		TP_IDLE_HYBRID,   // idle threads poll for jobs Settings::u_li_spin_count times, then park
+		TP_IDLE_SPIN,     // idle threads poll for jobs until they find one, so each keeps a CPU busy
+		TP_IDLE_PARK      // idle threads park right away
+	}; // end enum IDLE_STRATEGIES
+}; // end class Thread_Pool_Base
+
+
+///<summary>
+/// Compile-time configuration of a <see cref="BasicThreadPool"/>, and the configuration of <see cref="ThreadPool"/>.
+///</summary>
+///<remarks>
+/// Configurations derive from this and hide the constants they change. A configuration fixing the queue backend 
+/// or the idle strategy turns the run time checks for them into constants, so the code of the other choices is eliminated.
+/// Metrics are part of the configuration, so pools with and without metrics can be used in one program,
+/// THREAD_POOL_ENABLE_METRICS only selects the default.
+///</remarks>
+struct Thread_Pool_Config
+{
+	static constexpr std::size_t M_JOB_BUFFER_SIZE = 64;                                        //! the bytes of a callable stored inline in a job, larger callables are allocated
+	static constexpr std::size_t M_DEFAULT_CAPACITY = 1000;                                     //! the default of Settings::u_li_capacity
+	static constexpr std::size_t M_DEFAULT_SPIN_COUNT = 64;                                     //! the default of Settings::u_li_spin_count
+	static constexpr std::size_t M_CACHE_LINE_SIZE = Cache_Line::M_SIZE;                        //! the alignment of state written by different threads, including the queues and deques, fix it to keep the layout stable across tuning flags
+	static constexpr Thread_Pool_Base::QUEUE_BACKENDS  M_QUEUE = Thread_Pool_Base::TP_QUEUE_ANY;  //! the backend of the shared queues, TP_QUEUE_ANY to use Settings::e_queue
+	static constexpr Thread_Pool_Base::IDLE_STRATEGIES M_IDLE = Thread_Pool_Base::TP_IDLE_HYBRID; //! what idle threads do
+#ifdef THREAD_POOL_ENABLE_METRICS
+	static constexpr bool M_METRICS = true;                                                     //! whether or not jobs are stamped and threads keep the counters returned by Stats
+#else
+	static constexpr bool M_METRICS = false;                                                    //! whether or not jobs are stamped and threads keep the counters returned by Stats
+#endif
+}; // end struct Thread_Pool_Config
+
+
+///<summary>
+/// Thread pool configured at compile time by <typeparamref name="Config"/>, see <see cref="Thread_Pool_Config"/>.
+///</summary>
+template <class Config = Thread_Pool_Config>
+class BasicThreadPool : public Thread_Pool_Base
+{
+	using Guard_t = std::lock_guard<std::mutex>;
+	using Lock_t  = std::unique_lock<std::mutex>;
+
+	struct Worker_t;
+	struct Node_Queue_t;
+	struct Metrics_t;
+	struct Timer_t;
+	struct Executor_t;
+	struct Strand_t;
+	template <class T> struct Future_State_t;
+	template <class T> struct Promise_t;
+	template <class Chunk_Fn> struct Chunks_t;
+	template <class Chunk_Fn> struct Chunk_Run_t;
+#ifdef __cpp_lib_coroutine
+	struct Resume_t;
+	struct Detached_t;
+#endif
+	using Worker_Table_t = std::vector<Worker_t*>;
 
 
+#ifdef THREAD_POOL_ENABLE_TRACING
 	///<summary>
-	/// Initializes the thread pool to support <paramref name="ku_li_N_THREADS_"/> threads.
+	/// The kinds of events recorded while tracing.
+	///</summary>
+	enum TRACE_EVENTS : std::uint32_t
+	{
+		TP_TRACE_ENQUEUE,
+		TP_TRACE_START,
+		TP_TRACE_END,
+		TP_TRACE_STEAL,
+		TP_TRACE_PARK,
+		TP_TRACE_UNPARK
+	}; // end enum TRACE_EVENTS
+#endif
+
+
+	///<summary>
+	/// Counter of outstanding jobs that threads can block on until it reaches 0.
 	///</summary>
-	///<param name="ku_li_N_THREADS_">The number of threads this pool should support.</param>
 	///<remarks>
-	/// The threads will not be started the moment the pool is initialized, 
-	/// to start the threads, Start_All_Threads or Start_N_Threads must be invoked.
+	/// Only the decrement that reaches 0 takes the mutex, and it does so for the whole decrement,
+	/// so a waiting thread that observes 0 while holding the mutex knows that no job accesses
+	/// the latch anymore, and may destroy it.
 	///</remarks>
-	ThreadPool(const std::size_t ku_li_N_THREADS_)
+	struct Latch_t
 	{
-		// threads must be started explicitly
-		mu_li_nrunning = 0;
-		mu_li_nthreads = ku_li_N_THREADS_;
-		m_vect_threads.reserve(mu_li_nthreads);
-	} // end Constructor(1)
+		std::atomic<std::size_t> ma_u_li_count;   //! the number of outstanding jobs
+		std::exception_ptr       m_exptr_first;   //! the first exception thrown by a job, protected by m_mtx
+		std::mutex               m_mtx;           //! mutex protecting the exception and the final decrement
+		std::condition_variable  m_cv;            //! condition waiting threads block on
+
+		explicit Latch_t(const std::size_t ku_li_COUNT_)
+			: ma_u_li_count(ku_li_COUNT_)
+		{
+		} // end Constructor
+
+		///<summary>
+		/// Adds <paramref name="ku_li_COUNT_"/> outstanding jobs.
+		///</summary>
+		void Count_Up(const std::size_t ku_li_COUNT_ = 1) noexcept
+		{
+			ma_u_li_count.fetch_add(ku_li_COUNT_, std::memory_order_relaxed);
+		} // end method Count_Up
+
+		///<summary>
+		/// Marks <paramref name="ku_li_COUNT_"/> jobs as completed, the jobs must not access the latch afterwards.
+		///</summary>
+		void Count_Down(const std::size_t ku_li_COUNT_ = 1)
+		{
+			std::size_t u_li_count = ma_u_li_count.load(std::memory_order_relaxed);
+
+			while (u_li_count > ku_li_COUNT_)
+			{
+				if (ma_u_li_count.compare_exchange_weak(u_li_count, u_li_count - ku_li_COUNT_, std::memory_order_acq_rel) == true)
+				{
+					return;
+				} // end if
+			} // end while
+
+			Guard_t guard(m_mtx);
+
+			if (ma_u_li_count.fetch_sub(ku_li_COUNT_, std::memory_order_acq_rel) == ku_li_COUNT_)
+			{
+				m_cv.notify_all();
+			} // end if
+		} // end method Count_Down
+
+		///<summary>
+		/// Records <paramref name="exptr_"/> unless an exception was recorded before.
+		///</summary>
+		void Fail(std::exception_ptr exptr_)
+		{
+			Guard_t guard(m_mtx);
+
+			if (!m_exptr_first)
+			{
+				m_exptr_first = exptr_;
+			} // end if
+		} // end method Fail
+
+		///<summary>
+		/// Blocks until all jobs have completed and returns the first exception thrown by any of them.
+		///</summary>
+		///<returns>The first recorded exception, or a nullptr, the latch no longer holds the exception afterwards.</returns>
+		std::exception_ptr Wait(void)
+		{
+			Lock_t lock(m_mtx);
+
+			m_cv.wait(lock, [this](void) { return ma_u_li_count.load(std::memory_order_acquire) == 0; });
+
+			std::exception_ptr exptr_out = m_exptr_first;
+			m_exptr_first = nullptr;
+
+			return exptr_out;
+		} // end method Wait
+	}; // end struct Latch_t
+
+public:
+	static constexpr std::size_t M_DEFAULT_SPIN_COUNT = Config::M_DEFAULT_SPIN_COUNT;
+	static constexpr std::size_t M_DEFAULT_CAPACITY = Config::M_DEFAULT_CAPACITY;
+	static constexpr std::size_t M_JOB_BUFFER_SIZE = Config::M_JOB_BUFFER_SIZE;
+	static constexpr QUEUE_BACKENDS M_QUEUE = Config::M_QUEUE;
+	static constexpr IDLE_STRATEGIES M_IDLE = Config::M_IDLE;
+	static constexpr bool M_METRICS = Config::M_METRICS;
+	static constexpr std::size_t M_CHUNKS_PER_THREAD = 8;
+	static constexpr std::size_t M_DEFAULT_STARVATION_LIMIT = 8;
+	static constexpr std::size_t M_CACHE_LINE_SIZE = Config::M_CACHE_LINE_SIZE;
+	static constexpr std::size_t M_DEFAULT_SPAWN_DEPTH = 16;
+	static constexpr std::size_t M_DEFAULT_MAX_COMPENSATING = 64;
+	static constexpr std::size_t M_N_KEYED_STRANDS = 256;
+	static constexpr std::size_t M_STRAND_BATCH_SIZE = 16;
+	static constexpr std::chrono::milliseconds M_TIMER_TICK = std::chrono::milliseconds(1);
+	static constexpr std::chrono::milliseconds M_HELP_POLL_INTERVAL = std::chrono::milliseconds(1);
+	static constexpr std::size_t M_N_HISTOGRAM_BUCKETS = 32;
+#ifdef THREAD_POOL_ENABLE_TRACING
+	static constexpr std::size_t M_TRACE_BUFFER_SIZE = 16384;
+#endif
+
+	using Job_t = Basic_Job<M_JOB_BUFFER_SIZE, M_METRICS>;
+
+
+	///<summary>
+	/// Optional settings used to initialize a thread pool.
+	///</summary>
+	struct Settings
+	{
+		SCHEDULING_MODES e_scheduling    = SCHEDULING_MODES::TP_SHARED_QUEUE; //! how jobs are distributed among threads
+		std::size_t      u_li_spin_count = M_DEFAULT_SPIN_COUNT;              //! the number of times idle threads poll for jobs before they park
+		QUEUE_BACKENDS   e_queue         = QUEUE_BACKENDS::TP_QUEUE_LOCKED;   //! the data structure backing the shared queue, ignored if the configuration selects one
+		std::size_t      u_li_capacity   = M_DEFAULT_CAPACITY;                //! the maximum number of jobs in the shared queue, for the ring buffer the size of the ring of every priority, rounded up to a power of two
+		std::size_t      u_li_starvation_limit = M_DEFAULT_STARVATION_LIMIT;  //! every n-th job a thread takes from the shared queue is taken from a lower priority first, 0 to disable
+		AFFINITY_MODES   e_affinity      = AFFINITY_MODES::TP_AFFINITY_NONE;  //! how threads are pinned to CPUs
+		std::vector<std::size_t> vect_cpus;                                   //! the CPUs threads are pinned to in explicit affinity mode
+		bool             b_node_queues   = false;                             //! whether or not every NUMA node gets its own shared queue, requires an affinity mode
+		std::size_t      u_li_min_threads = 0;                                //! elastic mode: the number of threads kept running when the pool is idle
+		std::size_t      u_li_max_threads = 0;                                //! elastic mode: the maximum number of threads, 0 disables elastic mode
+		std::size_t      u_li_spawn_depth = M_DEFAULT_SPAWN_DEPTH;            //! elastic mode: threads are added at once when more jobs than this wait while no thread is idle
+		std::chrono::milliseconds dur_spawn_wait = std::chrono::milliseconds(10);      //! elastic mode: threads are added when jobs waited this long while no thread was idle
+		std::chrono::milliseconds dur_idle_timeout = std::chrono::milliseconds(30000); //! elastic mode: threads idle for longer than this are retired
+		std::size_t      u_li_max_compensating = M_DEFAULT_MAX_COMPENSATING;  //! the maximum number of threads started to stand in for threads in blocking regions, 0 to disable
+		SHUTDOWN_POLICIES e_shutdown     = SHUTDOWN_POLICIES::TP_SHUTDOWN_CANCEL; //! how the destructor shuts the pool down
+		std::chrono::milliseconds dur_shutdown_timeout = std::chrono::milliseconds(5000); //! the time pending jobs are given with TP_SHUTDOWN_DEADLINE
+		std::function<void(std::exception_ptr)> fn_exception_handler;        //! receives exceptions thrown by jobs, instead of the exception queue
+		Slab_Arena::Resource_t* p_memory_resource = nullptr;                 //! the upstream of the job arenas, nullptr for the default resource, must outlive all futures of the pool
+	}; // end struct Settings
 
 
 	///<summary>
-	/// Alerts all threads to terminate, clears the job queue, and then waits for all threads to terminate.
+	/// Distribution of durations on a logarithmic scale.
 	///</summary>
 	///<remarks>
-	/// Threads will be allowed to finish before being terminated, however, if jobs are still in the job
-	/// queue, they will not be executed but instead discarded.
+	/// Bucket i counts durations of [2^i, 2^(i+1)) nanoseconds, the first bucket also counts 
+	/// shorter durations and the last bucket also counts longer durations.
 	///</remarks>
-	~ThreadPool(void)
+	struct Histogram
 	{
-		// signal all threads to terminate
-		m_mtx_signals.lock();
-		std::for_each(m_vect_signals.begin(), m_vect_signals.end(),
-			[&](auto& thread_signal)
+		std::size_t arr_u_li_counts[M_N_HISTOGRAM_BUCKETS] = {}; //! the number of durations in every bucket
+
+		///<summary>
+		/// Returns the total number of durations in the histogram.
+		///</summary>
+		std::size_t Count(void) const noexcept
+		{
+			std::size_t u_li_out = 0;
+
+			for (const auto ku_li_COUNT : arr_u_li_counts)
 			{
-				thread_signal = THREAD_SIGNALS::TP_SIGTERM;
-			} // end lambda
-		); // end foreach
-		m_mtx_signals.unlock();
+				u_li_out += ku_li_COUNT;
+			} // end for ku_li_COUNT
 
-		Empty_Job_Queue();
+			return u_li_out;
+		} // end method Count
 
-		// wait for all threads to terminate
-		for (auto& t : m_vect_threads)
+		///<summary>
+		/// Returns an upper bound of the duration at or below which <paramref name="kd_FRACTION_"/> of all durations lie.
+		///</summary>
+		///<param name="kd_FRACTION_">The fraction of durations, e.g. 0.99 for the 99th percentile.</param>
+		///<returns>The upper end of the bucket containing the percentile, zero if the histogram is empty.</returns>
+		std::chrono::nanoseconds Percentile(const double kd_FRACTION_) const noexcept
 		{
-			if (t.joinable())
+			const std::size_t ku_li_TOTAL = Count();
+			std::size_t u_li_sum = 0;
+
+			for (std::size_t i = 0; i < M_N_HISTOGRAM_BUCKETS && ku_li_TOTAL != 0; i++)
 			{
-				t.join();
+				u_li_sum += arr_u_li_counts[i];
+
+				if (static_cast<double>(u_li_sum) >= kd_FRACTION_ * static_cast<double>(ku_li_TOTAL))
+				{
+					return std::chrono::nanoseconds(std::chrono::nanoseconds::rep(2) << i);
+				} // end if
+			} // end for i
+
+			return std::chrono::nanoseconds(0);
+		} // end method Percentile
+
+		///<summary>
+		/// Adds the counts of <paramref name="k_other_"/> to this histogram.
+		///</summary>
+		void Merge(const Histogram& k_other_) noexcept
+		{
+			for (std::size_t i = 0; i < M_N_HISTOGRAM_BUCKETS; i++)
+			{
+				arr_u_li_counts[i] += k_other_.arr_u_li_counts[i];
+			} // end for i
+		} // end method Merge
+	}; // end struct Histogram
+
+
+	///<summary>
+	/// Counters of one thread of the pool, or of all threads outside the pool that executed jobs.
+	///</summary>
+	struct Worker_Stats
+	{
+		std::size_t              u_li_nexecuted = 0;        //! the number of jobs executed
+		std::size_t              u_li_nstolen = 0;          //! the number of jobs stolen from other threads
+		std::size_t              u_li_deque_high_water = 0; //! the largest number of jobs seen in the thread's deque
+		std::chrono::nanoseconds dur_busy{ 0 };             //! the time spent executing jobs
+		std::chrono::nanoseconds dur_idle{ 0 };             //! the time spent looking or waiting for jobs
+		Histogram                hist_latency;              //! time from adding a job to a pool until its execution started
+		Histogram                hist_execution;            //! time spent executing a job
+	}; // end struct Worker_Stats
+
+
+	///<summary>
+	/// Snapshot of the metrics of a pool, see <see cref="ThreadPool::Stats"/>.
+	///</summary>
+	struct Pool_Stats
+	{
+		std::vector<Worker_Stats> vect_workers;            //! the counters of every thread ever started, indexed by id
+		Worker_Stats              external;                //! the counters of threads outside the pool
+		Histogram                 hist_latency;            //! the latency histograms of all threads merged
+		Histogram                 hist_execution;          //! the execution time histograms of all threads merged
+		std::size_t               u_li_queue_high_water = 0; //! the largest number of jobs seen in any shared queue
+		std::size_t               u_li_nqueued = 0;        //! the number of jobs in the shared queues
+	}; // end struct Pool_Stats
+
+
+	template <class T> class Future;
+
+
+	///<summary>
+	/// Group of jobs executed by a thread pool that can be waited for independently of all other jobs of the pool.
+	///</summary>
+	///<remarks>
+	/// Jobs may be added to a group from any thread, including jobs of the same group, 
+	/// and the group may be reused after waiting for it. The group must outlive its jobs,
+	/// the destructor therefore waits for all outstanding jobs.
+	///</remarks>
+	class Task_Group
+	{
+	public:
+		// Disallow any kind of copy/move operation, jobs refer to the group
+		Task_Group(const Task_Group&) = delete;
+		Task_Group(Task_Group&&) = delete;
+		Task_Group& operator=(const Task_Group&) = delete;
+		Task_Group& operator=(Task_Group&&) = delete;
+
+
+		///<summary>
+		/// Initializes an empty group of jobs executed by <paramref name="pool_"/>.
+		///</summary>
+		///<param name="pool_">The pool executing the jobs of this group.</param>
+		explicit Task_Group(BasicThreadPool& pool_)
+			: m_pool(pool_), m_latch(0)
+		{
+		} // end Constructor
+
+
+		///<summary>
+		/// Waits for all outstanding jobs of the group, exceptions thrown by those jobs are discarded.
+		///</summary>
+		~Task_Group(void)
+		{
+			m_pool.wait_helping(m_latch);
+		} // end Destructor
+
+
+		///<summary>
+		/// Adds a job invoking <paramref name="fn_"/> to the group and to the end of the execution queue of the pool.
+		///</summary>
+		///<remarks>
+		/// Blocks while the queue of the pool is full, like <see="ThreadPool::Add_Job" />.
+		/// If the job throws, the first exception thrown by any job of the group is rethrown by <see="Wait" />,
+		/// a job discarded by the pool without being executed counts as throwing a std::future_error with broken_promise.
+		///</remarks>
+		///<param name="fn_">The callable to invoke, it is moved or copied into the job.</param>
+		///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+		template <class F>
+		void Add_Job(F&& fn_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+		{
+			m_latch.Count_Up();
+
+			m_pool.Add_Job(Group_Run_t<std::decay_t<F>>(&m_latch, std::forward<F>(fn_)), ke_PRIORITY_);
+		} // end method Add_Job
+
+
+		///<summary>
+		/// Adds a job invoking <paramref name="fn_"/> with the arguments <paramref name="args_"/> to the group,
+		/// and returns a future that receives the result of the invocation, like <see="ThreadPool::Submit" />.
+		///</summary>
+		///<remarks>
+		/// Exceptions thrown by the callable are stored in the future and are not rethrown by <see="Wait" />.
+		///</remarks>
+		///<param name="fn_">The callable to invoke.</param>
+		///<param name="args_">The arguments to invoke the callable with.</param>
+		///<returns>A future that receives the result of the invocation.</returns>
+		template <class F, class... Args>
+		auto Submit(F&& fn_, Args&&... args_) -> Future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
+		{
+			return Submit(JOB_PRIORITIES::TP_PRIORITY_NORMAL, std::forward<F>(fn_), std::forward<Args>(args_)...);
+		} // end method Submit
+
+
+		///<summary>
+		/// Adds a job of priority <paramref name="ke_PRIORITY_"/> invoking <paramref name="fn_"/> with the arguments
+		/// <paramref name="args_"/> to the group, and returns a future that receives the result of the invocation.
+		///</summary>
+		///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+		///<param name="fn_">The callable to invoke.</param>
+		///<param name="args_">The arguments to invoke the callable with.</param>
+		///<returns>A future that receives the result of the invocation.</returns>
+		template <class F, class... Args>
+		auto Submit(const JOB_PRIORITIES ke_PRIORITY_, F&& fn_, Args&&... args_) -> Future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
+		{
+			Promise_t<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> promise(&m_pool);
+			auto future = promise.Get_Future();
+
+			Add_Job(make_task(std::move(promise), std::forward<F>(fn_), std::forward<Args>(args_)...), ke_PRIORITY_);
+
+			return future;
+		} // end method Submit
+
+
+		///<summary>
+		/// Blocks until all jobs of this group have completed, executing queued jobs of the pool in the meantime.
+		///</summary>
+		///<remarks>
+		/// Only the jobs of this group are waited for, jobs added to the pool by other callers may still be pending.
+		/// If any job of the group threw an exception since the last call, the first such exception is rethrown.
+		///</remarks>
+		void Wait(void)
+		{
+			std::exception_ptr exptr_first = m_pool.wait_helping(m_latch);
+
+			if (exptr_first)
+			{
+				std::rethrow_exception(exptr_first);
 			} // end if
-		} // end for t
-	} // end Destructor
+		} // end method Wait
+
+
+		///<summary>
+		/// Accessor for the number of jobs of this group that have not completed.
+		///</summary>
+		///<returns>The number of outstanding jobs at the time of invocation.</returns>
+		std::size_t N_Pending(void) const noexcept
+		{
+			return m_latch.ma_u_li_count.load(std::memory_order_acquire);
+		} // end method N_Pending
+
+
+	private:
+		///<summary>
+		/// Job invoking a callable of a group. A job that is destroyed without being executed, 
+		/// e.g. by <see cref="ThreadPool::Empty_Job_Queue"/>, records a std::future_error with broken_promise 
+		/// and still counts down, so that waiting for the group returns.
+		/// The callable is destroyed before the job counts down, waiting for the group may destroy what it captured.
+		///</summary>
+		template <class F>
+		struct Group_Run_t
+		{
+			Latch_t*         mp_latch; //! the latch of the group, nullptr once executed or moved
+			std::optional<F> m_opt_fn; //! the callable, reset before counting down
+
+			template <class G>
+			Group_Run_t(Latch_t* p_latch_, G&& fn_)
+				: mp_latch(p_latch_), m_opt_fn(std::in_place, std::forward<G>(fn_))
+			{
+			} // end Constructor(1)
+
+			Group_Run_t(Group_Run_t&& other_)
+				: mp_latch(std::exchange(other_.mp_latch, nullptr)), m_opt_fn(std::move(other_.m_opt_fn))
+			{
+			} // end Constructor(2)
+
+			~Group_Run_t(void)
+			{
+				if (mp_latch != nullptr)
+				{
+					m_opt_fn.reset();
+					mp_latch->Fail(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+					mp_latch->Count_Down();
+				} // end if
+			} // end Destructor
+
+			void operator()(void)
+			{
+				Latch_t* p_latch = std::exchange(mp_latch, nullptr);
+
+				try
+				{
+					(*m_opt_fn)();
+				} // end try
+				catch (...)
+				{
+					p_latch->Fail(std::current_exception());
+				} // end catch all
+
+				m_opt_fn.reset();
+				p_latch->Count_Down();
+			} // end operator()
+		}; // end struct Group_Run_t
+
+
+		BasicThreadPool& m_pool;   //! the pool executing the jobs
+		Latch_t          m_latch;  //! counter of outstanding jobs
+
+	}; // end class Task_Group
 
 
 	///<summary>
-	/// Starts all threads. All threads will begin executing jobs.
+	/// Future receiving the result of a job submitted to a thread pool, with the interface of std::future 
+	/// and continuations that are executed by the pool once the result is available.
 	///</summary>
-	///<returns>
-	/// True on success, false if an issue occurs. 
-	///</returns>
 	///<remarks>
-	/// The threads will begin executing jobs as they become available.
+	/// Like a std::future, a future is move-only and its result can be retrieved once, get and Then 
+	/// leave the future without a shared state. A future converts to a std::future of the same result.
 	///</remarks>
-	bool Start_All_Threads(void)
+	template <class T>
+	class Future
 	{
-		return Start_N_Threads(mu_li_nthreads);
-	} // end method 
+		///<summary>
+		/// The result of a continuation <typeparamref name="F"/> invoked with the result of this future.
+		///</summary>
+		template <class F>
+		using Then_Result_t = typename std::conditional_t<std::is_void<T>::value, std::invoke_result<std::decay_t<F>&>, std::invoke_result<std::decay_t<F>&, T>>::type;
+
+	public:
+		// Disallow copying, the result can only be retrieved once
+		Future(const Future&) = delete;
+		Future& operator=(const Future&) = delete;
+
+		Future(Future&&) noexcept = default;
+		Future& operator=(Future&&) noexcept = default;
+
+
+		///<summary>
+		/// Initializes a future without a shared state.
+		///</summary>
+		Future(void) noexcept = default;
+
+
+		///<summary>
+		/// Returns whether or not the future refers to a shared state.
+		///</summary>
+		bool valid(void) const noexcept
+		{
+			return mp_state != nullptr;
+		} // end method valid
+
+
+		///<summary>
+		/// Returns whether or not the result is available, without blocking.
+		///</summary>
+		///<returns>True if the future refers to a shared state whose result is available.</returns>
+		bool is_ready(void) const noexcept
+		{
+			return mp_state != nullptr && mp_state->ma_b_ready.load(std::memory_order_acquire) == true;
+		} // end method is_ready
+
+
+		///<summary>
+		/// Blocks until the result is available and returns it, the future no longer refers to the shared state afterwards.
+		///</summary>
+		///<returns>The result of the job.</returns>
+		///<exception cref="std::future_error">Thrown if the future has no shared state, or with broken_promise if the job was discarded.</exception>
+		///<remarks>Any exception thrown by the job is rethrown.</remarks>
+		T get(void)
+		{
+			check();
+
+			std::shared_ptr<Future_State_t<T>> p_state = std::move(mp_state);
+
+			p_state->Wait();
+
+			return p_state->Take();
+		} // end method get
+
+
+		///<summary>
+		/// Blocks until the result is available.
+		///</summary>
+		///<exception cref="std::future_error">Thrown if the future has no shared state.</exception>
+		void wait(void) const
+		{
+			check();
+			mp_state->Wait();
+		} // end method wait
+
+
+		///<summary>
+		/// Blocks until the result is available or <paramref name="k_timeout_"/> has passed.
+		///</summary>
+		///<returns>std::future_status::ready if the result is available, std::future_status::timeout otherwise.</returns>
+		///<exception cref="std::future_error">Thrown if the future has no shared state.</exception>
+		template <class Rep, class Period>
+		std::future_status wait_for(const std::chrono::duration<Rep, Period>& k_timeout_) const
+		{
+			return wait_until(std::chrono::steady_clock::now() + k_timeout_);
+		} // end method wait_for
+
+
+		///<summary>
+		/// Blocks until the result is available or <paramref name="k_deadline_"/> has passed.
+		///</summary>
+		///<returns>std::future_status::ready if the result is available, std::future_status::timeout otherwise.</returns>
+		///<exception cref="std::future_error">Thrown if the future has no shared state.</exception>
+		template <class Clock, class Duration>
+		std::future_status wait_until(const std::chrono::time_point<Clock, Duration>& k_deadline_) const
+		{
+			check();
+
+			return mp_state->Wait_Until(k_deadline_) == true ? std::future_status::ready : std::future_status::timeout;
+		} // end method wait_until
+
+
+		///<summary>
+		/// Adds a continuation invoking <paramref name="fn_"/> with the result of this future to the pool once
+		/// the result is available, and returns a future that receives the result of the continuation.
+		///</summary>
+		///<param name="fn_">The continuation, invoked with the result, or without arguments if there is no result.</param>
+		///<param name="ke_PRIORITY_">The priority the continuation is added with.</param>
+		///<returns>A future that receives the result of the continuation.</returns>
+		///<exception cref="std::future_error">Thrown if the future has no shared state.</exception>
+		///<remarks>
+		/// The continuation is added by the thread completing the job, which in work stealing mode is its own deque,
+		/// so nothing blocks in between and the result is likely still in cache. If the result is available already,
+		/// the calling thread adds the continuation. If the job threw, the continuation is not invoked and the returned
+		/// future receives the exception. The future no longer refers to the shared state afterwards.
+		///</remarks>
+		template <class F>
+		auto Then(F&& fn_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL) -> Future<Then_Result_t<F>>
+		{
+			using Result_t = Then_Result_t<F>;
+
+			check();
+
+			std::shared_ptr<Future_State_t<T>> p_state = std::move(mp_state);
+			Future_State_t<T>& state = *p_state;
+			Promise_t<Result_t> promise(state.mp_pool);
+			Future<Result_t> future = promise.Get_Future();
+
+			state.On_Ready(
+				[p_state = std::move(p_state), promise = std::move(promise), fn = std::forward<F>(fn_)](void) mutable
+				{
+					// an exception of the job is rethrown by Take and passed on by the promise
+					if constexpr (std::is_void<T>::value == true)
+					{
+						promise.Run([&](void) -> Result_t { p_state->Take(); return fn(); });
+					} // end if
+					else
+					{
+						promise.Run([&](void) -> Result_t { return fn(p_state->Take()); });
+					} // end else
+				}, // end lambda
+				true, ke_PRIORITY_
+			);
+
+			return future;
+		} // end method Then
+
+
+		///<summary>
+		/// Converts the future to a std::future receiving the same result, the future no longer refers to the shared state afterwards.
+		///</summary>
+		///<returns>A std::future for the result, or a std::future without a shared state if the future has none.</returns>
+		operator std::future<T>(void) &&
+		{
+			std::promise<T> promise;
+			std::future<T> future = promise.get_future();
+
+			if (mp_state == nullptr)
+			{
+				return std::future<T>();
+			} // end if
+
+			std::shared_ptr<Future_State_t<T>> p_state = std::move(mp_state);
+			Future_State_t<T>& state = *p_state;
+
+			// the std::promise is fulfilled by the thread completing the job, no job is added for it
+			state.On_Ready(
+				[p_state = std::move(p_state), promise = std::move(promise)](void) mutable
+				{
+					try
+					{
+						if constexpr (std::is_void<T>::value == true)
+						{
+							p_state->Take();
+							promise.set_value();
+						} // end if
+						else
+						{
+							promise.set_value(p_state->Take());
+						} // end else
+					} // end try
+					catch (...)
+					{
+						promise.set_exception(std::current_exception());
+					} // end catch all
+				}, // end lambda
+				false, JOB_PRIORITIES::TP_PRIORITY_NORMAL
+			);
+
+			return future;
+		} // end operator std::future
+
+
+	private:
+		friend class BasicThreadPool;
+
+		explicit Future(std::shared_ptr<Future_State_t<T>> p_state_) noexcept
+			: mp_state(std::move(p_state_))
+		{
+		} // end Constructor(2)
+
+
+		///<summary>
+		/// Throws a std::future_error with no_state if the future has no shared state.
+		///</summary>
+		void check(void) const
+		{
+			if (mp_state == nullptr)
+			{
+				throw std::future_error(std::future_errc::no_state);
+			} // end if
+		} // end method check
+
+
+		std::shared_ptr<Future_State_t<T>> mp_state; //! the shared state, shared with the promise of the job
+
+	}; // end class Future
 
 
 	///<summary>
-	/// Starts <paramref name="ku_li_N_THREADS_"/> threads. These threads will begin executing jobs.
+	/// The result of invoking <typeparamref name="F"/> with a Stop_Token followed by <typeparamref name="Args"/> if it accepts one, 
+	/// or with <typeparamref name="Args"/> only otherwise.
+	///</summary>
+	template <class F, class... Args>
+	using Stop_Result_t = typename std::conditional_t<std::is_invocable<std::decay_t<F>, Stop_Token, std::decay_t<Args>...>::value,
+		std::invoke_result<std::decay_t<F>, Stop_Token, std::decay_t<Args>...>, std::invoke_result<std::decay_t<F>, std::decay_t<Args>...>>::type;
+
+
+	///<summary>
+	/// Future of a job returned by <see cref="Submit_Cancellable"/>, together with the source that cancels the job.
+	///</summary>
+	///<remarks>
+	/// Like the future it holds, a handle is move-only. Dropping the handle does not cancel the job.
+	///</remarks>
+	template <class T>
+	class Cancellable
+	{
+	public:
+		///<summary>
+		/// Requests the job to stop. A queued job is skipped, a running job observes the request through its token.
+		///</summary>
+		///<returns>True if this call made the request, false if the job was cancelled before.</returns>
+		bool Cancel(void) noexcept
+		{
+			return m_source.Request_Stop();
+		} // end method Cancel
+
+
+		///<summary>
+		/// Returns whether or not the job was cancelled, which does not tell whether it was executed.
+		///</summary>
+		bool Cancelled(void) const noexcept
+		{
+			return m_source.Stop_Requested();
+		} // end method Cancelled
+
+
+		///<summary>
+		/// Accessor for the future receiving the result of the job, a skipped job breaks its promise.
+		///</summary>
+		Future<T>& Get_Future(void) noexcept
+		{
+			return m_future;
+		} // end method Get_Future
+
+
+		///<summary>
+		/// Accessor for the source cancelling the job, it may be used to cancel other jobs along with it.
+		///</summary>
+		const Stop_Source& Get_Stop_Source(void) const noexcept
+		{
+			return m_source;
+		} // end method Get_Stop_Source
+
+
+	private:
+		friend class BasicThreadPool;
+
+		Cancellable(Future<T>&& future_, Stop_Source source_) noexcept
+			: m_future(std::move(future_)), m_source(std::move(source_))
+		{
+		} // end Constructor
+
+		Future<T>   m_future; //! the future receiving the result of the job
+		Stop_Source m_source; //! the source cancelling the job
+
+	}; // end class Cancellable
+
+
+	///<summary>
+	/// Graph of jobs executed by a thread pool, where every job is added to the pool once all jobs it depends on have completed.
+	///</summary>
+	///<remarks>
+	/// Tasks and dependencies are added before the graph is run, and the graph may be run again after waiting for it,
+	/// invoking every task once per run. Every task counts its outstanding dependencies, and the thread completing the last
+	/// one adds the task to the pool, which in work stealing mode is the deque of that thread, so the task likely finds
+	/// the data of its dependencies in cache. If a task throws, the tasks depending on it are skipped, 
+	/// as are the tasks depending on a task the pool discarded without executing it.
+	/// The graph must outlive its run, the destructor therefore waits for all outstanding tasks.
+	///</remarks>
+	class Task_Graph
+	{
+		///<summary>
+		/// A task of the graph.
+		///</summary>
+		struct Node_t
+		{
+			Job_t                    m_job;                //! the job of the task, invoked once per run
+			JOB_PRIORITIES           me_priority;          //! the priority the task is added with
+			std::vector<std::size_t> m_vect_successors;    //! the tasks depending on this task
+			std::size_t              mu_li_npredecessors;  //! the number of tasks this task depends on
+			std::atomic<std::size_t> ma_u_li_npending;     //! the number of dependencies that have not completed in the current run
+			std::atomic<bool>        ma_b_skip;            //! whether or not a dependency failed or was skipped in the current run
+
+			Node_t(Job_t&& fn_job_, const JOB_PRIORITIES ke_PRIORITY_)
+				: m_job(std::move(fn_job_)), me_priority(ke_PRIORITY_), mu_li_npredecessors(0), ma_u_li_npending(0), ma_b_skip(false)
+			{
+			} // end Constructor
+		}; // end struct Node_t
+
+	public:
+		// Disallow any kind of copy/move operation, jobs refer to the graph
+		Task_Graph(const Task_Graph&) = delete;
+		Task_Graph(Task_Graph&&) = delete;
+		Task_Graph& operator=(const Task_Graph&) = delete;
+		Task_Graph& operator=(Task_Graph&&) = delete;
+
+
+		///<summary>
+		/// Initializes an empty graph of tasks executed by <paramref name="pool_"/>.
+		///</summary>
+		///<param name="pool_">The pool executing the tasks of this graph.</param>
+		explicit Task_Graph(BasicThreadPool& pool_)
+			: m_pool(pool_), m_latch(0)
+		{
+		} // end Constructor
+
+
+		///<summary>
+		/// Waits for all outstanding tasks of the graph, exceptions thrown by those tasks are discarded.
+		///</summary>
+		~Task_Graph(void)
+		{
+			m_pool.wait_helping(m_latch);
+		} // end Destructor
+
+
+		///<summary>
+		/// Adds a task invoking <paramref name="fn_"/> once all tasks in <paramref name="k_list_dependencies_"/> have completed.
+		///</summary>
+		///<param name="fn_">The callable to invoke, it is moved or copied into the graph.</param>
+		///<param name="k_list_dependencies_">The ids of the tasks the new task depends on.</param>
+		///<param name="ke_PRIORITY_">The priority the task is added to the pool with.</param>
+		///<returns>The id of the new task.</returns>
+		///<exception cref="std::out_of_range">Thrown if a dependency is not the id of a task of this graph.</exception>
+		///<remarks>Must not be called while the graph is running.</remarks>
+		template <class F>
+		std::size_t Add_Task(F&& fn_, const std::initializer_list<std::size_t> k_list_dependencies_ = {}, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+		{
+			for (const auto ku_li_DEPENDENCY : k_list_dependencies_)
+			{
+				check(ku_li_DEPENDENCY);
+			} // end for ku_li_DEPENDENCY
+
+			m_vect_nodes.emplace_back(new Node_t(Job_t(std::forward<F>(fn_)), ke_PRIORITY_));
+
+			const std::size_t ku_li_ID = m_vect_nodes.size() - 1;
+
+			for (const auto ku_li_DEPENDENCY : k_list_dependencies_)
+			{
+				Add_Dependency(ku_li_DEPENDENCY, ku_li_ID);
+			} // end for ku_li_DEPENDENCY
+
+			return ku_li_ID;
+		} // end method Add_Task
+
+
+		///<summary>
+		/// Makes the task <paramref name="ku_li_AFTER_"/> wait for the task <paramref name="ku_li_BEFORE_"/> to complete.
+		///</summary>
+		///<param name="ku_li_BEFORE_">The id of the task that has to complete first.</param>
+		///<param name="ku_li_AFTER_">The id of the task that depends on it.</param>
+		///<exception cref="std::out_of_range">Thrown if either id is not the id of a task of this graph.</exception>
+		///<remarks>Must not be called while the graph is running. Cycles are detected by <see cref="Run"/>.</remarks>
+		void Add_Dependency(const std::size_t ku_li_BEFORE_, const std::size_t ku_li_AFTER_)
+		{
+			check(ku_li_BEFORE_);
+			check(ku_li_AFTER_);
+
+			m_vect_nodes[ku_li_BEFORE_]->m_vect_successors.push_back(ku_li_AFTER_);
+			m_vect_nodes[ku_li_AFTER_]->mu_li_npredecessors++;
+		} // end method Add_Dependency
+
+
+		///<summary>
+		/// Adds all tasks without dependencies to the pool, the other tasks follow as their dependencies complete.
+		///</summary>
+		///<exception cref="std::logic_error">Thrown if the dependencies form a cycle, no task is run in that case.</exception>
+		///<remarks>
+		/// Blocks while the queue of the pool is full, like <see="ThreadPool::Add_Job" />.
+		/// The graph must not be run again before <see cref="Wait"/> returned.
+		///</remarks>
+		void Run(void)
+		{
+			if (is_acyclic() == false)
+			{
+				throw std::logic_error("Task_Graph contains a cycle");
+			} // end if
+
+			for (auto& p_node : m_vect_nodes)
+			{
+				p_node->ma_u_li_npending.store(p_node->mu_li_npredecessors, std::memory_order_relaxed);
+				p_node->ma_b_skip.store(false, std::memory_order_relaxed);
+			} // end for p_node
+
+			m_latch.Count_Up(m_vect_nodes.size());
+
+			for (std::size_t i = 0; i < m_vect_nodes.size(); i++)
+			{
+				if (m_vect_nodes[i]->mu_li_npredecessors == 0)
+				{
+					m_pool.Add_Job(Graph_Run_t(this, i), m_vect_nodes[i]->me_priority);
+				} // end if
+			} // end for i
+		} // end method Run
+
+
+		///<summary>
+		/// Blocks until all tasks of the current run have completed or were skipped, executing queued jobs of the pool in the meantime.
+		///</summary>
+		///<remarks>
+		/// If any task threw an exception, the first such exception is rethrown.
+		///</remarks>
+		void Wait(void)
+		{
+			std::exception_ptr exptr_first = m_pool.wait_helping(m_latch);
+
+			if (exptr_first)
+			{
+				std::rethrow_exception(exptr_first);
+			} // end if
+		} // end method Wait
+
+
+		///<summary>
+		/// Accessor for the number of tasks in this graph.
+		///</summary>
+		std::size_t N_Tasks(void) const noexcept
+		{
+			return m_vect_nodes.size();
+		} // end method N_Tasks
+
+
+	private:
+		///<summary>
+		/// Throws std::out_of_range if <paramref name="ku_li_ID_"/> is not the id of a task of this graph.
+		///</summary>
+		void check(const std::size_t ku_li_ID_) const
+		{
+			if (ku_li_ID_ >= m_vect_nodes.size())
+			{
+				throw std::out_of_range("Task_Graph has no task with the given id");
+			} // end if
+		} // end method check
+
+
+		///<summary>
+		/// Returns whether or not the dependencies are free of cycles, by removing tasks without remaining dependencies until none is left.
+		///</summary>
+		bool is_acyclic(void) const
+		{
+			std::vector<std::size_t> vect_npending(m_vect_nodes.size());
+			std::vector<std::size_t> vect_ready;
+			std::size_t u_li_nremoved = 0;
+
+			for (std::size_t i = 0; i < m_vect_nodes.size(); i++)
+			{
+				vect_npending[i] = m_vect_nodes[i]->mu_li_npredecessors;
+
+				if (vect_npending[i] == 0)
+				{
+					vect_ready.push_back(i);
+				} // end if
+			} // end for i
+
+			while (vect_ready.empty() == false)
+			{
+				const std::size_t ku_li_ID = vect_ready.back();
+
+				vect_ready.pop_back();
+				u_li_nremoved++;
+
+				for (const auto ku_li_SUCCESSOR : m_vect_nodes[ku_li_ID]->m_vect_successors)
+				{
+					if (--vect_npending[ku_li_SUCCESSOR] == 0)
+					{
+						vect_ready.push_back(ku_li_SUCCESSOR);
+					} // end if
+				} // end for ku_li_SUCCESSOR
+			} // end while
+
+			return u_li_nremoved == m_vect_nodes.size();
+		} // end method is_acyclic
+
+
+		///<summary>
+		/// Executes the task <paramref name="ku_li_ID_"/> unless it is skipped, and adds the tasks that become ready to the pool.
+		///</summary>
+		void run_task(const std::size_t ku_li_ID_)
+		{
+			Node_t& node = *m_vect_nodes[ku_li_ID_];
+			bool b_failed = node.ma_b_skip.load(std::memory_order_acquire);
+
+			if (b_failed == false)
+			{
+				try
+				{
+					node.m_job();
+				} // end try
+				catch (...)
+				{
+					m_latch.Fail(std::current_exception());
+					b_failed = true;
+				} // end catch all
+			} // end if
+
+			for (const auto ku_li_SUCCESSOR : node.m_vect_successors)
+			{
+				Node_t& successor = *m_vect_nodes[ku_li_SUCCESSOR];
+
+				if (b_failed == true)
+				{
+					successor.ma_b_skip.store(true, std::memory_order_relaxed);
+				} // end if
+
+				if (successor.ma_u_li_npending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					Job_t fn_job(Graph_Run_t(this, ku_li_SUCCESSOR));
+
+					m_pool.push_forced(fn_job, successor.me_priority);
+				} // end if
+			} // end for ku_li_SUCCESSOR
+
+			m_latch.Count_Down();
+		} // end method run_task
+
+
+		///<summary>
+		/// Counts down the task <paramref name="ku_li_ID_"/>, whose job was discarded by the pool, and skips all tasks depending on it.
+		///</summary>
+		///<remarks>
+		/// The tasks that become ready are skipped right away instead of being added to the pool,
+		/// which may be shutting down, the run fails with a std::future_error with broken_promise.
+		///</remarks>
+		void discard_task(const std::size_t ku_li_ID_)
+		{
+			m_latch.Fail(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+
+			std::vector<std::size_t> vect_skipped{ ku_li_ID_ };
+
+			// every task on the stack holds one count of the latch, the graph outlives the loop
+			while (vect_skipped.empty() == false)
+			{
+				const std::size_t ku_li_ID = vect_skipped.back();
+
+				vect_skipped.pop_back();
+
+				for (const auto ku_li_SUCCESSOR : m_vect_nodes[ku_li_ID]->m_vect_successors)
+				{
+					Node_t& successor = *m_vect_nodes[ku_li_SUCCESSOR];
+
+					successor.ma_b_skip.store(true, std::memory_order_relaxed);
+
+					if (successor.ma_u_li_npending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						vect_skipped.push_back(ku_li_SUCCESSOR);
+					} // end if
+				} // end for ku_li_SUCCESSOR
+
+				m_latch.Count_Down();
+			} // end while
+		} // end method discard_task
+
+
+		///<summary>
+		/// Job running a task of the graph, a job destroyed without being executed discards the task.
+		///</summary>
+		struct Graph_Run_t
+		{
+			Task_Graph* mp_graph; //! the graph of the task, nullptr once executed or moved
+			std::size_t mu_li_id; //! the id of the task
+
+			Graph_Run_t(Task_Graph* p_graph_, const std::size_t ku_li_ID_) noexcept
+				: mp_graph(p_graph_), mu_li_id(ku_li_ID_)
+			{
+			} // end Constructor(1)
+
+			Graph_Run_t(Graph_Run_t&& other_) noexcept
+				: mp_graph(std::exchange(other_.mp_graph, nullptr)), mu_li_id(other_.mu_li_id)
+			{
+			} // end Constructor(2)
+
+			~Graph_Run_t(void)
+			{
+				if (mp_graph != nullptr)
+				{
+					mp_graph->discard_task(mu_li_id);
+				} // end if
+			} // end Destructor
+
+			void operator()(void)
+			{
+				std::exchange(mp_graph, nullptr)->run_task(mu_li_id);
+			} // end operator()
+		}; // end struct Graph_Run_t
+
+
+		BasicThreadPool&                     m_pool;        //! the pool executing the tasks
+		Latch_t                              m_latch;       //! counter of outstanding tasks of the current run
+		std::vector<std::unique_ptr<Node_t>> m_vect_nodes;  //! the tasks by id
+
+	}; // end class Task_Graph
+
+
+	///<summary>
+	/// Handle of a job scheduled by Schedule_After, Schedule_At or Schedule_Every that can cancel it.
+	///</summary>
+	///<remarks>
+	/// Handles may be copied, all copies refer to the same scheduled job. Dropping every handle does not
+	/// cancel the job. A cancelled job is released once its time would have come.
+	///</remarks>
+	class Timer_Handle
+	{
+	public:
+		///<summary>
+		/// Initializes a handle that refers to no job.
+		///</summary>
+		Timer_Handle(void) = default;
+
+
+		///<summary>
+		/// Cancels the scheduled job. A periodic job that is executing completes, but is not executed again.
+		///</summary>
+		///<returns>True if the job was cancelled, false if it was dispatched or cancelled before, or the handle refers to no job.</returns>
+		bool Cancel(void) noexcept
+		{
+			return mp_timer != nullptr && mp_timer->Cancel();
+		} // end method Cancel
+
+
+		///<summary>
+		/// Returns whether or not the scheduled job will still be dispatched, which a periodic job is until it is cancelled.
+		///</summary>
+		///<returns>True if the job has been neither dispatched nor cancelled at the time of invocation.</returns>
+		bool Pending(void) const noexcept
+		{
+			return mp_timer != nullptr && mp_timer->ma_e_state.load(std::memory_order_acquire) == Timer_t::TP_TIMER_PENDING;
+		} // end method Pending
+
+
+	private:
+		friend class BasicThreadPool;
+
+		explicit Timer_Handle(std::shared_ptr<Timer_t> p_timer_)
+			: mp_timer(std::move(p_timer_))
+		{
+		} // end Constructor(2)
+
+		std::shared_ptr<Timer_t> mp_timer; //! the scheduled job, shared with the timer wheel
+
+	}; // end class Timer_Handle
+
+
+	///<summary>
+	/// Handle of a named executor created by <see cref="Create_Executor"/>, a queue of jobs executed by the threads of the pool.
+	///</summary>
+	///<remarks>
+	/// Whenever a thread of the pool turns to executor jobs, it picks the next executor by deficit round robin, 
+	/// so every executor with queued jobs receives a share of the jobs executed proportional to its weight, 
+	/// however many jobs other executors queue. An executor with a concurrency limit never has more jobs executing at once.
+	/// Handles may be copied, all copies refer to the same executor, which lives as long as the pool.
+	///</remarks>
+	class Executor
+	{
+	public:
+		///<summary>
+		/// Initializes a handle that refers to no executor.
+		///</summary>
+		Executor(void) = default;
+
+
+		///<summary>
+		/// Adds a job invoking <paramref name="fn_"/> to the end of the queue of the executor.
+		///</summary>
+		///<remarks>
+		/// Blocks while the queue of the pool is full and the job could be executed right away, like <see="ThreadPool::Add_Job" />.
+		/// Exceptions thrown by the job are reported like those of any other job.
+		///</remarks>
+		///<param name="fn_">The callable to invoke, it is moved or copied into the job.</param>
+		template <class F>
+		void Add_Job(F&& fn_)
+		{
+			mp_pool->add_executor_job(*mp_executor, Job_t(std::forward<F>(fn_)));
+		} // end method Add_Job
+
+
+		///<summary>
+		/// Adds a job invoking <paramref name="fn_"/> with the arguments <paramref name="args_"/> to the executor,
+		/// and returns a future that receives the result of the invocation, like <see="ThreadPool::Submit" />.
+		///</summary>
+		///<param name="fn_">The callable to invoke.</param>
+		///<param name="args_">The arguments to invoke the callable with.</param>
+		///<returns>A future that receives the result of the invocation.</returns>
+		template <class F, class... Args>
+		auto Submit(F&& fn_, Args&&... args_) -> Future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
+		{
+			Promise_t<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> promise(mp_pool);
+			auto future = promise.Get_Future();
+
+			Add_Job(make_task(std::move(promise), std::forward<F>(fn_), std::forward<Args>(args_)...));
+
+			return future;
+		} // end method Submit
+
+
+		///<summary>
+		/// Accessor for the name of the executor.
+		///</summary>
+		const std::string& Name(void) const noexcept
+		{
+			return mp_executor->m_str_name;
+		} // end method Name
+
+
+		///<summary>
+		/// Accessor for the weight of the executor, its share of the executed jobs relative to the other executors.
+		///</summary>
+		std::size_t Weight(void) const noexcept
+		{
+			return mp_executor->mu_li_weight;
+		} // end method Weight
+
+
+		///<summary>
+		/// Accessor for the maximum number of jobs of the executor executing at once, 0 if unlimited.
+		///</summary>
+		std::size_t Max_Concurrency(void) const noexcept
+		{
+			return mp_executor->mu_li_max_concurrency;
+		} // end method Max_Concurrency
+
+
+		///<summary>
+		/// Returns the number of jobs of the executor that are waiting for execution.
+		///</summary>
+		///<returns>The number of queued jobs at the time of invocation.</returns>
+		std::size_t N_Jobs_Queued(void) const
+		{
+			Guard_t guard(mp_pool->m_mtx_executors);
+
+			return mp_executor->m_q_jobs.size();
+		} // end method N_Jobs_Queued
+
+
+		///<summary>
+		/// Returns the number of jobs of the executor that are executing.
+		///</summary>
+		///<returns>The number of executing jobs at the time of invocation.</returns>
+		std::size_t N_Jobs_Running(void) const
+		{
+			Guard_t guard(mp_pool->m_mtx_executors);
+
+			return mp_executor->mu_li_nrunning;
+		} // end method N_Jobs_Running
+
+
+	private:
+		friend class BasicThreadPool;
+
+		Executor(BasicThreadPool* p_pool_, std::shared_ptr<Executor_t> p_executor_)
+			: mp_pool(p_pool_), mp_executor(std::move(p_executor_))
+		{
+		} // end Constructor(2)
+
+		BasicThreadPool*            mp_pool = nullptr; //! the pool executing the jobs
+		std::shared_ptr<Executor_t> mp_executor;       //! the state of the executor, shared with the pool
+
+	}; // end class Executor
+
+
+	///<summary>
+	/// Handle of a strand created by <see cref="Create_Strand"/> or <see cref="Get_Strand"/>, a queue of jobs 
+	/// executed by the threads of the pool one after another in the order they were added.
+	///</summary>
+	///<remarks>
+	/// A job of a strand never executes concurrently with another job of the same strand, and every job 
+	/// observes the effects of the jobs added before it, so state only touched by the jobs of one strand needs no locking.
+	/// Jobs of a strand don't block threads while waiting for their turn, the strand has at most one job in the queue of 
+	/// the pool, which executes the next job of the strand and adds itself again if jobs are left.
+	/// A sticky strand executes up to <see cref="M_STRAND_BATCH_SIZE"/> jobs in a row on the thread that took it, 
+	/// so their data stays in the caches of that thread, at the expense of other jobs waiting longer.
+	/// Handles may be copied, all copies refer to the same strand, which must not be used after the pool is destroyed.
+	///</remarks>
+	class Strand
+	{
+	public:
+		///<summary>
+		/// Initializes a handle that refers to no strand.
+		///</summary>
+		Strand(void) = default;
+
+
+		///<summary>
+		/// Adds a job invoking <paramref name="fn_"/> to the end of the strand.
+		///</summary>
+		///<remarks>
+		/// Blocks while the queue of the pool is full and the strand has to be added to it, like <see="ThreadPool::Add_Job" />.
+		/// Exceptions thrown by the job are reported like those of any other job, the next job of the strand is executed regardless.
+		///</remarks>
+		///<param name="fn_">The callable to invoke, it is moved or copied into the job.</param>
+		template <class F>
+		void Add_Job(F&& fn_)
+		{
+			mp_pool->add_strand_job(mp_strand, Job_t(std::forward<F>(fn_)));
+		} // end method Add_Job
+
+
+		///<summary>
+		/// Adds a job invoking <paramref name="fn_"/> with the arguments <paramref name="args_"/> to the strand,
+		/// and returns a future that receives the result of the invocation, like <see="ThreadPool::Submit" />.
+		///</summary>
+		///<param name="fn_">The callable to invoke.</param>
+		///<param name="args_">The arguments to invoke the callable with.</param>
+		///<returns>A future that receives the result of the invocation.</returns>
+		template <class F, class... Args>
+		auto Submit(F&& fn_, Args&&... args_) -> Future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
+		{
+			Promise_t<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> promise(mp_pool);
+			auto future = promise.Get_Future();
+
+			Add_Job(make_task(std::move(promise), std::forward<F>(fn_), std::forward<Args>(args_)...));
+
+			return future;
+		} // end method Submit
+
+
+		///<summary>
+		/// Accessor for whether or not the strand executes batches of jobs on one thread.
+		///</summary>
+		bool Sticky(void) const noexcept
+		{
+			return mp_strand->mb_sticky;
+		} // end method Sticky
+
+
+		///<summary>
+		/// Returns the number of jobs of the strand that are waiting for execution.
+		///</summary>
+		///<returns>The number of queued jobs at the time of invocation.</returns>
+		std::size_t N_Jobs_Queued(void) const
+		{
+			Guard_t guard(mp_strand->m_mtx);
+
+			return mp_strand->m_q_jobs.size();
+		} // end method N_Jobs_Queued
+
+
+	private:
+		friend class BasicThreadPool;
+
+		Strand(BasicThreadPool* p_pool_, std::shared_ptr<Strand_t> p_strand_)
+			: mp_pool(p_pool_), mp_strand(std::move(p_strand_))
+		{
+		} // end Constructor(2)
+
+		BasicThreadPool*          mp_pool = nullptr; //! the pool executing the jobs
+		std::shared_ptr<Strand_t> mp_strand;         //! the state of the strand, shared with its job in the queue of the pool
+
+	}; // end class Strand
+
+
+	///<summary>
+	/// Scope guard marking the calling thread of the pool as blocked, for jobs that wait on I/O or on other threads.
+	///</summary>
+	///<remarks>
+	/// While threads of the pool are inside regions, as many compensating threads execute jobs in their place, so the number 
+	/// of threads executing jobs stays close to the number of threads the pool runs otherwise. Compensating threads that 
+	/// stand by are woken up first, new ones are started by the manager thread up to <see cref="Settings::u_li_max_compensating"/>.
+	/// Once a thread leaves its region, a compensating thread finishes its job and stands by until it is 
+	/// needed again, compensating threads only terminate when the pool is resized or shut down, or when they time out in 
+	/// elastic mode. Regions may be nested, only the outermost region of a thread counts. On threads outside the pool, 
+	/// a region does nothing, they never take the place of a thread of the pool.
+	///</remarks>
+	class Blocking_Region
+	{
+	public:
+		// Disallow any kind of copy/move operation, the region belongs to the scope it was entered in
+		Blocking_Region(const Blocking_Region&) = delete;
+		Blocking_Region(Blocking_Region&&) = delete;
+		Blocking_Region& operator=(const Blocking_Region&) = delete;
+		Blocking_Region& operator=(Blocking_Region&&) = delete;
+
+
+		///<summary>
+		/// Enters a blocking region of <paramref name="pool_"/>, if the calling thread belongs to it.
+		///</summary>
+		///<param name="pool_">The pool the calling thread is compensated in.</param>
+		explicit Blocking_Region(BasicThreadPool& pool_)
+			: mp_pool(ts_p_pool == &pool_ ? &pool_ : nullptr)
+		{
+			if (mp_pool != nullptr)
+			{
+				mp_pool->enter_blocking();
+			} // end if
+		} // end Constructor
+
+
+		///<summary>
+		/// Leaves the blocking region.
+		///</summary>
+		~Blocking_Region(void)
+		{
+			if (mp_pool != nullptr)
+			{
+				mp_pool->exit_blocking();
+			} // end if
+		} // end Destructor
+
+
+	private:
+		BasicThreadPool* const mp_pool; //! the pool of the calling thread, nullptr if it does not belong to the pool
+
+	}; // end class Blocking_Region
+
+#ifdef __cpp_lib_coroutine
+
+	///<summary>
+	/// Awaitable returned by <see cref="Schedule"/>, awaiting it resumes the coroutine on a thread of the pool.
+	///</summary>
+	class Schedule_Awaiter
+	{
+	public:
+		bool await_ready(void) const noexcept
+		{
+			return false;
+		} // end method await_ready
+
+
+		///<summary>
+		/// Adds a job resuming <paramref name="handle_"/> to the pool, like <see="ThreadPool::Add_Job" />.
+		///</summary>
+		void await_suspend(std::coroutine_handle<> handle_)
+		{
+			// the coroutine may be resumed, and this awaiter destroyed, before Add_Job returns
+			m_pool.Add_Job(Resume_t(this, handle_), me_priority);
+		} // end method await_suspend
+
+
+		///<summary>
+		/// Reports whether the coroutine was resumed by the pool.
+		///</summary>
+		///<exception cref="std::future_error">Thrown with broken_promise if the job resuming the coroutine was discarded.</exception>
+		void await_resume(void) const
+		{
+			if (mb_discarded == true)
+			{
+				throw std::future_error(std::future_errc::broken_promise);
+			} // end if
+		} // end method await_resume
+
+
+	private:
+		friend class BasicThreadPool;
+
+		Schedule_Awaiter(BasicThreadPool& pool_, const JOB_PRIORITIES ke_PRIORITY_) noexcept
+			: m_pool(pool_), me_priority(ke_PRIORITY_), mb_discarded(false)
+		{
+		} // end Constructor
+
+		BasicThreadPool& m_pool;       //! the pool resuming the coroutine
+		JOB_PRIORITIES   me_priority;  //! the priority of the job resuming the coroutine
+		bool             mb_discarded; //! whether the job resuming the coroutine was discarded instead of executed
+
+	}; // end class Schedule_Awaiter
+
+#endif
+
+	// Disallow any kind of copy/move operation on thread pools
+	BasicThreadPool(const BasicThreadPool&) = delete;
+	BasicThreadPool(BasicThreadPool&&) = delete;
+	BasicThreadPool& operator=(const BasicThreadPool&) = delete;
+	BasicThreadPool& operator=(BasicThreadPool&&) = delete;
+
+
+	///<summary>
+	/// Initializes the thread pool to support <paramref name="ku_li_N_THREADS_"/> threads.
+	///</summary>
+	///<param name="ku_li_N_THREADS_">The number of threads this pool should support.</param>
+	///<remarks>
+	/// The threads will not be started the moment the pool is initialized, 
+	/// to start the threads, Start_All_Threads or Start_N_Threads must be invoked.
+	///</remarks>
+	BasicThreadPool(const std::size_t ku_li_N_THREADS_)
+		: BasicThreadPool(ku_li_N_THREADS_, Settings())
+	{
+	} // end Constructor(1)
+
+
+	///<summary>
+	/// Initializes the thread pool to support <paramref name="ku_li_N_THREADS_"/> threads
+	/// using the given <paramref name="k_settings_"/>.
+	///</summary>
+	///<param name="ku_li_N_THREADS_">The number of threads this pool should support.</param>
+	///<param name="k_settings_">The settings of this pool.</param>
+	///<remarks>
+	/// The threads will not be started the moment the pool is initialized, 
+	/// to start the threads, Start_All_Threads or Start_N_Threads must be invoked.
+	/// Idle threads poll for jobs <see cref="Settings::u_li_spin_count"/> times before
+	/// they park themselves, a spin count of 0 parks idle threads immediately.
+	/// With node queues, the capacity applies to the queue of every node.
+	/// In elastic mode, the pool starts <paramref name="ku_li_N_THREADS_"/> threads like any other pool,
+	/// and adds or retires threads afterwards, see <see cref="Settings::u_li_max_threads"/>.
+	///</remarks>
+	///<exception cref="std::invalid_argument">Thrown if explicit affinity is requested without any CPUs.</exception>
+	BasicThreadPool(const std::size_t ku_li_N_THREADS_, const Settings& k_settings_)
+		: ma_u_li_nrunning(0), mb_stop_manager(false), mb_compensate(false),
+		mp_memory_resource(k_settings_.p_memory_resource != nullptr ? k_settings_.p_memory_resource : Slab_Arena::Default_Resource()), m_arena_external(mp_memory_resource),
+		m_arena_executors(mp_memory_resource), mu_li_executor_cursor(0), mu_li_executor_runnable(0), mu_li_executor_tokens(0),
+		ma_u_li_nsubmitted(0), ma_u_li_next_node(0), ma_u_li_ncompleted(0), ma_u_li_ndiscarded(0), ma_u_li_nparked(0), ma_u_li_nblocked(0), ma_u_li_nsyncing(0),
+		ma_u_li_nblocking(0), ma_u_li_ncompensating(0), m_tp_timer_epoch(std::chrono::steady_clock::now()), mu_li_timer_wakeup(0)
+	{
+		// threads must be started explicitly
+		mu_li_nthreads = ku_li_N_THREADS_;
+		mu_li_min_threads = std::min(k_settings_.u_li_min_threads, mu_li_nthreads);
+		mu_li_max_threads = k_settings_.u_li_max_threads == 0 ? 0 : std::max(k_settings_.u_li_max_threads, mu_li_nthreads);
+		mu_li_spawn_depth = k_settings_.u_li_spawn_depth;
+		mu_li_max_compensating = k_settings_.u_li_max_compensating;
+		m_dur_spawn_wait = k_settings_.dur_spawn_wait;
+		m_dur_idle_timeout = k_settings_.dur_idle_timeout;
+		me_shutdown = k_settings_.e_shutdown;
+		m_dur_shutdown_timeout = k_settings_.dur_shutdown_timeout;
+		m_fn_exception_handler = k_settings_.fn_exception_handler;
+		mu_li_spin_count = k_settings_.u_li_spin_count;
+		mu_li_starvation_limit = k_settings_.u_li_starvation_limit;
+		me_scheduling = k_settings_.e_scheduling;
+		me_queue = M_QUEUE == QUEUE_BACKENDS::TP_QUEUE_ANY ? k_settings_.e_queue : M_QUEUE;
+		me_affinity = k_settings_.e_affinity;
+		m_vect_threads.reserve(mu_li_nthreads);
+
+		mu_li_capacity = k_settings_.u_li_capacity;
+
+		std::size_t u_li_nnodes = 1;
+
+		if (me_affinity != AFFINITY_MODES::TP_AFFINITY_NONE)
+		{
+			const CPU_Topology k_topology;
+
+			switch (me_affinity)
+			{
+			case AFFINITY_MODES::TP_AFFINITY_COMPACT:
+				m_vect_placement = k_topology.CPUs();
+				break;
+			case AFFINITY_MODES::TP_AFFINITY_SCATTER:
+				m_vect_placement = k_topology.Scattered();
+				break;
+			default:
+				if (k_settings_.vect_cpus.empty() == true)
+				{
+					throw std::invalid_argument("Explicit affinity requires at least one CPU");
+				} // end if
+
+				for (const auto ku_li_CPU : k_settings_.vect_cpus)
+				{
+					m_vect_placement.push_back(CPU_Topology::CPU_Info{ ku_li_CPU, k_topology.Node_Of(ku_li_CPU) });
+				} // end for ku_li_CPU
+				break;
+			} // end switch
+
+			if (k_settings_.b_node_queues == true)
+			{
+				u_li_nnodes = k_topology.N_Nodes();
+			} // end if
+		} // end if
+
+		for (std::size_t i = 0; i < u_li_nnodes; i++)
+		{
+			m_vect_nodes.emplace_back(new Node_Queue_t(me_queue, mu_li_capacity, mp_memory_resource));
+		} // end for i
+
+		if (uses_ring() == true)
+		{
+			mu_li_capacity = m_vect_nodes[0]->m_arr_p_ring_tasks[0]->Capacity();
+		} // end if
+
+		m_vect_tables.emplace_back(new Worker_Table_t());
+		ma_p_workers.store(m_vect_tables.back().get());
+	} // end Constructor(2)
+
+
+	///<summary>
+	/// Shuts the pool down with the policy given by <see cref="Settings::e_shutdown"/> and waits for all threads to terminate.
+	///</summary>
+	///<remarks>
+	/// Threads will be allowed to finish before being terminated. With the default policy, 
+	/// jobs still in the job queue are not executed but instead discarded.
+	///</remarks>
+	~BasicThreadPool(void)
+	{
+		shutdown(me_shutdown, std::chrono::steady_clock::now() + m_dur_shutdown_timeout);
+	} // end Destructor
+
+
+	///<summary>
+	/// Starts all threads. All threads will begin executing jobs.
+	///</summary>
+	///<returns>
+	/// True on success, false if an issue occurs. 
+	///</returns>
+	///<remarks>
+	/// The threads will begin executing jobs as they become available.
+	///</remarks>
+	bool Start_All_Threads(void)
+	{
+		return Start_N_Threads(mu_li_nthreads);
+	} // end method 
+
+
+	///<summary>
+	/// Starts <paramref name="ku_li_N_THREADS_"/> threads. These threads will begin executing jobs.
+	///</summary>
+	///<param name="ku_li_N_THREADS_">The number of threads to start.</param>
+	///<returns>
+	/// True on success, false if an issue occurs. 
+	///</returns>
+	///<remarks>
+	/// The value of <paramref name="ku_li_N_THREADS_"/> must be at least as large as 
+	/// the number of running threads in order for this call to succeed.
+	/// By providing an <paramref name="ku_li_N_THREADS_"/> value larger than the capacity
+	/// of the thread pool, the pool can be grown in size.
+	///</remarks>
+	bool Start_N_Threads(const std::size_t ku_li_N_THREADS_)
+	{
+		Guard_t guard(m_mtx_resize);
+
+		if (ku_li_N_THREADS_ < ma_u_li_nrunning)
+		{
+			return false;
+		} // end if
+
+		// compensating threads are kept as regular threads
+		ma_u_li_ncompensating.store(0);
+		start_threads(std::max(ku_li_N_THREADS_, mu_li_nthreads));
+		start_manager();
+
+		return true;
+	} // end method Start_N_Threads
+
+
+	///<summary>
+	/// Starts or retires threads until exactly <paramref name="ku_li_N_THREADS_"/> threads are running.
+	///</summary>
+	///<param name="ku_li_N_THREADS_">The number of threads that should be running.</param>
+	///<returns>
+	/// True on success, false if the calling thread belongs to this pool and would have to retire itself.
+	///</returns>
+	///<remarks>
+	/// Threads are retired starting with the highest id. A retired thread finishes the job it is executing, 
+	/// jobs left in its deque are stolen by the remaining threads. Compensating threads started for threads
+	/// in blocking regions count as running threads, and are kept as regular threads if the pool grows. This function blocks until all retired 
+	/// threads have terminated, so jobs executed by these threads must not resize the pool themselves.
+	/// Passing more threads than the pool supports grows the pool. In elastic mode, the pool keeps 
+	/// adding and retiring threads afterwards, within <see cref="Settings::u_li_min_threads"/> and 
+	/// <see cref="Settings::u_li_max_threads"/>.
+	///</remarks>
+	bool Resize(const std::size_t ku_li_N_THREADS_)
+	{
+		if (ts_p_pool == this && ts_p_worker->mu_li_id >= ku_li_N_THREADS_)
+		{
+			return false;
+		} // end if
+
+		Guard_t guard(m_mtx_resize);
+
+		if (ku_li_N_THREADS_ < ma_u_li_nrunning)
+		{
+			stop_threads(ku_li_N_THREADS_);
+		} // end if
+		else
+		{
+			// compensating threads are kept as regular threads
+			ma_u_li_ncompensating.store(0);
+			start_threads(ku_li_N_THREADS_);
+			start_manager();
+		} // end else
+
+		return true;
+	} // end method Resize
+
+
+	///<summary>
+	/// Forcefully adds the given job <paramref name="fn_job_"/> to the end of the execution queue, never waiting for room.
+	///</summary>
+	///<remarks>
+	/// The locked queue grows beyond its capacity. The ring buffer cannot hold more jobs than it has slots, 
+	/// so with the TP_QUEUE_RING backend, jobs that do not fit go to an unbounded overflow queue of the node instead.
+	///</remarks>
+	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	void Add_Job_Force(Job_t fn_job_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		push_forced(fn_job_, ke_PRIORITY_);
+	} // end method Add_Job_Force
+
+
+	///<summary>
+	/// Adds the given job <paramref name="fn_job_"/> to the end of the execution queue.
+	///</summary>
+	///<remarks>
+	/// This function will block if the maximum number of jobs are waiting in the execution 
+	/// queue, the calling thread is parked until a thread of the pool removes a job from the queue.
+	/// Use <see="Add_Job_I" /> for non-blocking version, or <see="Add_Job_For" /> to limit the wait.
+	/// Normal priority jobs added by a job in work stealing mode go to the thread's own deque and never block,
+	/// a job adding to a full shared queue executes queued jobs until there is room instead of parking.
+	///</remarks>
+	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	void Add_Job(Job_t fn_job_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		push_waiting([&](void) { return try_push_job(fn_job_, false, ke_PRIORITY_); });
+	} // end method Add_Job
+
+
+	///<summary>
+	/// Adds the given job <paramref name="fn_job_"/> to the end of the execution queue, waiting at most 
+	/// <paramref name="k_timeout_"/> for room in the queue. If successful, true is returned, otherwise false.
+	///</summary>
+	///<remarks>
+	/// If the job could not be added in time, it is destroyed without being executed.
+	///</remarks>
+	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
+	///<param name="k_timeout_">The maximum amount of time to wait for room in the queue.</param>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	///<returns>True if the job was added, false if the timeout expired first.</returns>
+	template <class Rep, class Period>
+	bool Add_Job_For(Job_t fn_job_, const std::chrono::duration<Rep, Period>& k_timeout_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		const auto k_DEADLINE = std::chrono::steady_clock::now() + k_timeout_;
+
+		return push_waiting([&](void) { return try_push_job(fn_job_, false, ke_PRIORITY_); }, &k_DEADLINE);
+	} // end method Add_Job_For
+
+
+	///<summary>
+	/// Adds the given job <paramref name="fn_job_"/> to the end of the execution queue, waiting until at most 
+	/// <paramref name="k_deadline_"/> for room in the queue. If successful, true is returned, otherwise false.
+	///</summary>
+	///<remarks>
+	/// If the job could not be added in time, it is destroyed without being executed.
+	///</remarks>
+	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
+	///<param name="k_deadline_">The point in time after which the job is no longer added.</param>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	///<returns>True if the job was added, false if the deadline passed first.</returns>
+	template <class Clock, class Duration>
+	bool Add_Job_Until(Job_t fn_job_, const std::chrono::time_point<Clock, Duration>& k_deadline_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		return push_waiting([&](void) { return try_push_job(fn_job_, false, ke_PRIORITY_); }, &k_deadline_);
+	} // end method Add_Job_Until
+
+
+	///<summary>
+	/// Attempts to add the given job <paramref name="fn_job_"/> to the end of the execution 
+	/// queue. If successful, true is returned, otherwise false.
+	///</summary>
+	///<remarks>
+	/// This function will not block if more than the maximum number of jobs are waiting 
+	/// in the execution queue, instead it will return false. Use <see="Add_Job" /> for 
+	/// a blocking version.
+	///</remarks>
+	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	///<returns>True if the job was added, false otherwise.</returns>
+	bool Add_Job_I(Job_t fn_job_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		return try_push_job(fn_job_, false, ke_PRIORITY_);
+	} // end method Add_Job_I
+
+
+	///<summary>
+	/// Adds all jobs in the range [<paramref name="first_"/>, <paramref name="last_"/>) to the end of the 
+	/// execution queue, in order. The jobs are moved from, the range is left holding empty jobs.
+	///</summary>
+	///<remarks>
+	/// The batch is added with a single lock acquisition, or a single reservation with the TP_QUEUE_RING
+	/// backend, and only as many parked threads as there are new jobs are woken up.
+	/// This function will block while the queue is full, like <see="Add_Job" />, in which case
+	/// the batch is added in parts as room becomes available.
+	///</remarks>
+	///<param name="first_">Iterator to the first job to add.</param>
+	///<param name="last_">Iterator one past the last job to add.</param>
+	///<param name="ke_PRIORITY_">The priority of all jobs, jobs of higher priority are executed first.</param>
+	template <class ForwardIt>
+	void Add_Jobs(ForwardIt first_, ForwardIt last_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		push_waiting([&](void) { return try_push_jobs(first_, last_, ke_PRIORITY_); });
+	} // end method Add_Jobs
+
+
+#ifdef __cpp_lib_span
+	///<summary>
+	/// Adds all jobs in <paramref name="jobs_"/> to the end of the execution queue, in order. 
+	/// The jobs are moved from, the span is left holding empty jobs.
+	///</summary>
+	///<remarks>
+	/// See <see="Add_Jobs(ForwardIt, ForwardIt)" />.
+	///</remarks>
+	///<param name="jobs_">The jobs to add.</param>
+	///<param name="ke_PRIORITY_">The priority of all jobs, jobs of higher priority are executed first.</param>
+	void Add_Jobs(std::span<Job_t> jobs_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		Add_Jobs(jobs_.begin(), jobs_.end(), ke_PRIORITY_);
+	} // end method Add_Jobs
+#endif
+
+
+	///<summary>
+	/// Adds a job invoking <paramref name="fn_"/> with the arguments <paramref name="args_"/> to the end 
+	/// of the execution queue and returns a future that receives the result of the invocation.
+	///</summary>
+	///<remarks>
+	/// The callable and its arguments are decay-copied (or moved) into the job, so they remain valid
+	/// until the job is executed. Exceptions thrown by the callable are stored in the future.
+	/// If the job is discarded before it is executed, e.g. by Empty_Job_Queue, the future
+	/// receives a std::future_error with the error code broken_promise.
+	/// The future converts to a std::future, and can be chained with <see cref="Future::Then"/>.
+	/// This function will block if more than the maximum number of jobs are waiting 
+	/// in the execution queue, like <see="Add_Job" />.
+	///</remarks>
+	///<param name="fn_">The callable to invoke.</param>
+	///<param name="args_">The arguments to invoke the callable with.</param>
+	///<returns>A future that receives the result of the invocation.</returns>
+	template <class F, class... Args>
+	auto Submit(F&& fn_, Args&&... args_) -> Future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
+	{
+		return Submit(JOB_PRIORITIES::TP_PRIORITY_NORMAL, std::forward<F>(fn_), std::forward<Args>(args_)...);
+	} // end method Submit
+
+
+	///<summary>
+	/// Adds a job of priority <paramref name="ke_PRIORITY_"/> invoking <paramref name="fn_"/> with the arguments 
+	/// <paramref name="args_"/> to the end of the execution queue and returns a future that receives the result.
+	///</summary>
+	///<remarks>
+	/// See <see="Submit(F&&, Args&&...)" />.
+	///</remarks>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	///<param name="fn_">The callable to invoke.</param>
+	///<param name="args_">The arguments to invoke the callable with.</param>
+	///<returns>A future that receives the result of the invocation.</returns>
+	template <class F, class... Args>
+	auto Submit(const JOB_PRIORITIES ke_PRIORITY_, F&& fn_, Args&&... args_) -> Future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
+	{
+		Promise_t<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> promise(this);
+		auto future = promise.Get_Future();
+
+		Add_Job(make_task(std::move(promise), std::forward<F>(fn_), std::forward<Args>(args_)...), ke_PRIORITY_);
+
+		return future;
+	} // end method Submit
+
+
+	///<summary>
+	/// Submits a job like <see cref="Submit"/> that invokes <paramref name="fn_"/> inside a <see cref="Blocking_Region"/>, 
+	/// for callables that spend most of their time blocked, e.g. on disk or network I/O.
+	///</summary>
+	///<param name="fn_">The callable to invoke.</param>
+	///<param name="args_">The arguments to invoke the callable with.</param>
+	///<returns>A future that receives the result of the invocation.</returns>
+	template <class F, class... Args>
+	auto Submit_Blocking(F&& fn_, Args&&... args_) -> Future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>
+	{
+		using Result_t = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+
+		Promise_t<Result_t> promise(this);
+		auto future = promise.Get_Future();
+
+		Add_Job(make_task(std::move(promise), [this, fn = std::forward<F>(fn_)](auto&&... args_job_) mutable -> Result_t
+		{
+			Blocking_Region region(*this);
+
+			return std::invoke(std::move(fn), std::forward<decltype(args_job_)>(args_job_)...);
+		}, std::forward<Args>(args_)...));
+
+		return future;
+	} // end method Submit_Blocking
+
+
+	///<summary>
+	/// Adds a job invoking <paramref name="fn_"/> with the arguments <paramref name="args_"/> to the end of the execution queue,
+	/// which is skipped once a stop is requested through <paramref name="token_"/>, and returns a future that receives the result.
+	///</summary>
+	///<remarks>
+	/// Cancelling a queued job is one store: the job stays in the queue as a tombstone and is destroyed without invoking the callable
+	/// once a thread takes it, so its future receives a std::future_error with broken_promise. A callable that is invocable with a 
+	/// Stop_Token followed by the arguments receives <paramref name="token_"/>, so it can poll it and stop early while running.
+	/// Any number of jobs may share the source of the token, they are cancelled together.
+	///</remarks>
+	///<param name="token_">The token observing stop requests for the job.</param>
+	///<param name="fn_">The callable to invoke.</param>
+	///<param name="args_">The arguments to invoke the callable with.</param>
+	///<returns>A future that receives the result of the invocation.</returns>
+	template <class F, class... Args>
+	auto Submit(Stop_Token token_, F&& fn_, Args&&... args_) -> Future<Stop_Result_t<F, Args...>>
+	{
+		return Submit(JOB_PRIORITIES::TP_PRIORITY_NORMAL, std::move(token_), std::forward<F>(fn_), std::forward<Args>(args_)...);
+	} // end method Submit
+
+
+	///<summary>
+	/// Adds a job of priority <paramref name="ke_PRIORITY_"/> invoking <paramref name="fn_"/> with the arguments <paramref name="args_"/>, 
+	/// which is skipped once a stop is requested through <paramref name="token_"/>, and returns a future that receives the result.
+	///</summary>
+	///<remarks>
+	/// See <see="Submit(Stop_Token, F&&, Args&&...)" />.
+	///</remarks>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	///<param name="token_">The token observing stop requests for the job.</param>
+	///<param name="fn_">The callable to invoke.</param>
+	///<param name="args_">The arguments to invoke the callable with.</param>
+	///<returns>A future that receives the result of the invocation.</returns>
+	template <class F, class... Args>
+	auto Submit(const JOB_PRIORITIES ke_PRIORITY_, Stop_Token token_, F&& fn_, Args&&... args_) -> Future<Stop_Result_t<F, Args...>>
+	{
+		Promise_t<Stop_Result_t<F, Args...>> promise(this);
+		auto future = promise.Get_Future();
+
+		Add_Job(make_stoppable_task(std::move(promise), std::move(token_), std::forward<F>(fn_), std::forward<Args>(args_)...), ke_PRIORITY_);
+
+		return future;
+	} // end method Submit
+
+
+	///<summary>
+	/// Adds a job invoking <paramref name="fn_"/> with the arguments <paramref name="args_"/> to the end of the execution queue,
+	/// and returns its future along with a new source that cancels it, see <see="Submit(Stop_Token, F&&, Args&&...)" />.
+	///</summary>
+	///<param name="fn_">The callable to invoke.</param>
+	///<param name="args_">The arguments to invoke the callable with.</param>
+	///<returns>A handle holding the future of the job and the source cancelling it.</returns>
+	template <class F, class... Args>
+	auto Submit_Cancellable(F&& fn_, Args&&... args_) -> Cancellable<Stop_Result_t<F, Args...>>
+	{
+		Stop_Source source;
+		auto future = Submit(source.Get_Token(), std::forward<F>(fn_), std::forward<Args>(args_)...);
+
+		return Cancellable<Stop_Result_t<F, Args...>>(std::move(future), std::move(source));
+	} // end method Submit_Cancellable
+
+
+	///<summary>
+	/// Adds a job invoking each callable in the range [<paramref name="first_"/>, <paramref name="last_"/>) 
+	/// to the end of the execution queue and returns futures that receive the results of the invocations.
+	///</summary>
+	///<remarks>
+	/// The callables are moved from. All jobs are added as one batch, see <see="Add_Jobs" />, 
+	/// the futures are in the same order as the callables.
+	///</remarks>
+	///<param name="first_">Iterator to the first callable.</param>
+	///<param name="last_">Iterator one past the last callable.</param>
+	///<param name="ke_PRIORITY_">The priority of all jobs, jobs of higher priority are executed first.</param>
+	///<returns>A vector of futures, one for every callable in the range.</returns>
+	template <class ForwardIt>
+	auto Submit_Bulk(ForwardIt first_, ForwardIt last_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL) 
+		-> std::vector<Future<std::invoke_result_t<typename std::iterator_traits<ForwardIt>::value_type&>>>
+	{
+		using Result_t = std::invoke_result_t<typename std::iterator_traits<ForwardIt>::value_type&>;
+
+		const auto k_li_COUNT = std::distance(first_, last_);
+		std::vector<Future<Result_t>> vect_futures;
+		std::vector<Job_t> vect_jobs;
+
+		vect_futures.reserve(k_li_COUNT);
+		vect_jobs.reserve(k_li_COUNT);
+
+		for (; first_ != last_; ++first_)
+		{
+			Promise_t<Result_t> promise(this);
+
+			vect_futures.push_back(promise.Get_Future());
+			vect_jobs.emplace_back(make_task(std::move(promise), std::move(*first_)));
+		} // end for first_
+
+		Add_Jobs(vect_jobs.begin(), vect_jobs.end(), ke_PRIORITY_);
+
+		return vect_futures;
+	} // end method Submit_Bulk
+
+
+	///<summary>
+	/// Invokes <paramref name="body_"/> once for every value i in [<paramref name="first_"/>, <paramref name="last_"/>)
+	/// using the threads of this pool, and blocks until all invocations have completed.
+	///</summary>
+	///<remarks>
+	/// The range is split into chunks of at least <paramref name="ku_li_GRAIN_"/> values, and into about
+	/// <see cref="M_CHUNKS_PER_THREAD"/> chunks per running thread for larger ranges. Chunks are handed out
+	/// by halving the range recursively, so idle threads pick up large parts of the remaining work.
+	/// Only the jobs of this call are waited for. While waiting, the calling thread executes queued jobs.
+	/// If any invocation throws, the remaining values of its chunk are skipped and the first exception
+	/// is rethrown once all chunks have completed.
+	///</remarks>
+	///<param name="first_">The first value, an integer or a random access iterator.</param>
+	///<param name="last_">One past the last value.</param>
+	///<param name="body_">The callable to invoke with every value, it is shared by all threads.</param>
+	///<param name="ku_li_GRAIN_">The minimum number of values per chunk, 0 to derive it from the number of threads.</param>
+	template <class Index, class Body>
+	void Parallel_For(const Index first_, const Index last_, Body&& body_, const std::size_t ku_li_GRAIN_ = 0)
+	{
+		const std::size_t ku_li_COUNT = last_ > first_ ? static_cast<std::size_t>(last_ - first_) : 0;
+		const std::size_t ku_li_CHUNK = chunk_size(ku_li_COUNT, ku_li_GRAIN_);
+
+		auto fn_chunk = [&](const std::size_t ku_li_CHUNK_) -> void
+		{
+			const std::size_t ku_li_BEGIN = ku_li_CHUNK_ * ku_li_CHUNK;
+			const std::size_t ku_li_END = std::min(ku_li_BEGIN + ku_li_CHUNK, ku_li_COUNT);
+
+			for (std::size_t i = ku_li_BEGIN; i < ku_li_END; i++)
+			{
+				// integers are passed with their own type, the body may be overloaded or take a narrower type
+				if constexpr (std::is_integral<Index>::value == true)
+				{
+					body_(static_cast<Index>(first_ + i));
+				} // end if
+				else
+				{
+					body_(first_ + static_cast<std::ptrdiff_t>(i));
+				} // end else
+			} // end for i
+		}; // end lambda
+
+		run_chunks((ku_li_COUNT + ku_li_CHUNK - 1) / ku_li_CHUNK, fn_chunk);
+	} // end method Parallel_For
+
+
+	///<summary>
+	/// Combines <paramref name="init_"/> and all elements in [<paramref name="first_"/>, <paramref name="last_"/>)
+	/// with <paramref name="op_"/> using the threads of this pool, and blocks until the result is known.
+	///</summary>
+	///<remarks>
+	/// The range is split into chunks like in <see="Parallel_For" />. Every chunk is reduced from left to right,
+	/// and the results of the chunks are then combined with <paramref name="init_"/> in the order of the chunks,
+	/// so <paramref name="op_"/> has to be associative, but does not have to be commutative.
+	/// If any invocation throws, the first exception is rethrown once all chunks have completed.
+	///</remarks>
+	///<param name="first_">Random access iterator to the first element.</param>
+	///<param name="last_">Random access iterator one past the last element.</param>
+	///<param name="init_">The initial value of the reduction.</param>
+	///<param name="op_">The binary operation combining two values, it is shared by all threads.</param>
+	///<param name="ku_li_GRAIN_">The minimum number of elements per chunk, 0 to derive it from the number of threads.</param>
+	///<returns>The result of the reduction, <paramref name="init_"/> if the range is empty.</returns>
+	template <class RandomIt, class T, class Op>
+	T Parallel_Reduce(const RandomIt first_, const RandomIt last_, T init_, Op&& op_, const std::size_t ku_li_GRAIN_ = 0)
+	{
+		const std::size_t ku_li_COUNT = last_ > first_ ? static_cast<std::size_t>(last_ - first_) : 0;
+		const std::size_t ku_li_CHUNK = chunk_size(ku_li_COUNT, ku_li_GRAIN_);
+		const std::size_t ku_li_NCHUNKS = (ku_li_COUNT + ku_li_CHUNK - 1) / ku_li_CHUNK;
+
+		// every chunk writes only its own slot, so no synchronization is needed besides the latch
+		std::vector<std::optional<T>> vect_partials(ku_li_NCHUNKS);
+
+		auto fn_chunk = [&](const std::size_t ku_li_CHUNK_) -> void
+		{
+			const std::size_t ku_li_BEGIN = ku_li_CHUNK_ * ku_li_CHUNK;
+			const std::size_t ku_li_END = std::min(ku_li_BEGIN + ku_li_CHUNK, ku_li_COUNT);
+			T partial = *(first_ + static_cast<std::ptrdiff_t>(ku_li_BEGIN));
+
+			for (std::size_t i = ku_li_BEGIN + 1; i < ku_li_END; i++)
+			{
+				partial = op_(std::move(partial), *(first_ + static_cast<std::ptrdiff_t>(i)));
+			} // end for i
+
+			vect_partials[ku_li_CHUNK_].emplace(std::move(partial));
+		}; // end lambda
+
+		run_chunks(ku_li_NCHUNKS, fn_chunk);
+
+		for (auto& partial : vect_partials)
+		{
+			init_ = op_(std::move(init_), std::move(*partial));
+		} // end for partial
+
+		return init_;
+	} // end method Parallel_Reduce
+
+
+	///<summary>
+	/// Adds the given job <paramref name="fn_job_"/> to the end of the execution queue once <paramref name="k_delay_"/> has passed.
+	///</summary>
+	///<param name="k_delay_">The time to wait before the job is added.</param>
+	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	///<returns>A handle that can cancel the job until it is added.</returns>
+	///<remarks>
+	/// Scheduled jobs are kept in a timer wheel with a resolution of <see cref="M_TIMER_TICK"/> and added by
+	/// a timer thread that is started with the first scheduled job. Jobs are never added early, and are added like
+	/// by Add_Job_Force once they are due. Until then, they are not pending jobs, Synchronize does not wait for them.
+	/// Shutdown and the destructor cancel all scheduled jobs.
+	///</remarks>
+	template <class Rep, class Period>
+	Timer_Handle Schedule_After(const std::chrono::duration<Rep, Period>& k_delay_, Job_t fn_job_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		return schedule(std::move(fn_job_), std::chrono::steady_clock::now() + std::chrono::ceil<std::chrono::steady_clock::duration>(k_delay_), 0, ke_PRIORITY_);
+	} // end method Schedule_After
+
+
+	///<summary>
+	/// Adds the given job <paramref name="fn_job_"/> to the end of the execution queue at <paramref name="k_time_"/>,
+	/// see <see cref="Schedule_After"/>.
+	///</summary>
+	///<param name="k_time_">The point in time at which the job is added, jobs of past points in time are added immediately.</param>
+	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	///<returns>A handle that can cancel the job until it is added.</returns>
+	///<remarks>
+	/// Points in time of clocks other than the steady clock are converted to the steady clock when the job is scheduled,
+	/// later adjustments of such a clock do not move the job.
+	///</remarks>
+	template <class Clock, class Duration>
+	Timer_Handle Schedule_At(const std::chrono::time_point<Clock, Duration>& k_time_, Job_t fn_job_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		if constexpr (std::is_same<Clock, std::chrono::steady_clock>::value == true)
+		{
+			return schedule(std::move(fn_job_), std::chrono::steady_clock::time_point(std::chrono::ceil<std::chrono::steady_clock::duration>(k_time_.time_since_epoch())), 0, ke_PRIORITY_);
+		} // end if
+		else
+		{
+			return Schedule_After(k_time_ - Clock::now(), std::move(fn_job_), ke_PRIORITY_);
+		} // end else
+	} // end method Schedule_At
+
+
+	///<summary>
+	/// Adds the given job <paramref name="fn_job_"/> to the end of the execution queue every <paramref name="k_period_"/>,
+	/// starting one period from now, until it is cancelled.
+	///</summary>
+	///<param name="k_period_">The time between two executions, rounded up to <see cref="M_TIMER_TICK"/>.</param>
+	///<param name="fn_job_">A ready-to-execute job that should be executed periodically, it is kept until the job is cancelled.</param>
+	///<param name="ke_PRIORITY_">The priority of the job, jobs of higher priority are executed first.</param>
+	///<returns>A handle that can cancel the job.</returns>
+	///<remarks>
+	/// The next execution is scheduled once an execution completes, so executions of the same job never overlap.
+	/// Executions are due at fixed intervals, executions that fall due while the previous one is still executing are skipped.
+	/// Exceptions thrown by the job are reported like exceptions of any other job and do not stop it. If an execution is
+	/// discarded from the queue, the job is cancelled. See <see cref="Schedule_After"/> for how scheduled jobs are added.
+	///</remarks>
+	template <class Rep, class Period>
+	Timer_Handle Schedule_Every(const std::chrono::duration<Rep, Period>& k_period_, Job_t fn_job_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		const std::uint64_t ku_li_PERIOD = std::max<std::uint64_t>(std::chrono::ceil<std::chrono::milliseconds>(k_period_) / M_TIMER_TICK, 1);
+
+		return schedule(std::move(fn_job_), std::chrono::steady_clock::now() + ku_li_PERIOD * M_TIMER_TICK, ku_li_PERIOD, ke_PRIORITY_);
+	} // end method Schedule_Every
+
+#ifdef __cpp_lib_coroutine
+
+	///<summary>
+	/// Returns an awaitable that suspends the awaiting coroutine and resumes it on a thread of the pool.
+	///</summary>
+	///<param name="ke_PRIORITY_">The priority of the job resuming the coroutine.</param>
+	///<returns>The awaitable, to be awaited once.</returns>
+	///<remarks>
+	/// The coroutine is resumed by an ordinary job, so awaiting the pool from a thread of the pool in work stealing mode
+	/// adds the job to the thread's own deque. Awaiting blocks while the queue is full, like Add_Job.
+	/// If the job is discarded, e.g. by Empty_Job_Queue or Shutdown, the coroutine is resumed by the discarding thread 
+	/// and the await throws a std::future_error with broken_promise, so that the coroutine can unwind.
+	///</remarks>
+	Schedule_Awaiter Schedule(const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL) noexcept
+	{
+		return Schedule_Awaiter(*this, ke_PRIORITY_);
+	} // end method Schedule
+
+
+	///<summary>
+	/// Starts <paramref name="task_"/> on a thread of the pool and returns a future that receives its result.
+	///</summary>
+	///<param name="task_">The task to run, it is owned by the pool until it completes.</param>
+	///<param name="ke_PRIORITY_">The priority of the job starting the task.</param>
+	///<returns>A future that receives the result of the task, or the exception that escaped it.</returns>
+	///<remarks>
+	/// This is how code outside of coroutines enters a coroutine, the task itself may hop to other threads or await other tasks. 
+	/// If the job starting the task is discarded, the task is destroyed without being started and the future receives 
+	/// a std::future_error with broken_promise.
+	///</remarks>
+	template <class T>
+	Future<T> Spawn(Task<T> task_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL)
+	{
+		Promise_t<T> promise(this);
+		Future<T> future = promise.Get_Future();
+
+		spawn(this, std::move(task_), std::move(promise), ke_PRIORITY_);
+
+		return future;
+	} // end method Spawn
+
+#endif
+
+
+	///<summary>
+	/// Creates an executor named <paramref name="k_str_name_"/>, whose jobs share the threads of this pool with all other jobs.
+	///</summary>
+	///<param name="k_str_name_">The name of the executor, unique within the pool.</param>
+	///<param name="ku_li_WEIGHT_">The share of executed jobs the executor receives relative to the other executors with queued jobs.</param>
+	///<param name="ku_li_MAX_CONCURRENCY_">The maximum number of jobs of the executor executing at once, 0 for no limit.</param>
+	///<returns>A handle to the executor.</returns>
+	///<exception cref="std::invalid_argument">Thrown if the weight is 0 or the pool has an executor of that name.</exception>
+	///<remarks>
+	/// Executors isolate tenants of one pool without adding threads, see <see cref="Executor"/>.
+	/// Jobs of executors are counted as pending jobs of the pool once they could be executed.
+	///</remarks>
+	Executor Create_Executor(const std::string& k_str_name_, const std::size_t ku_li_WEIGHT_ = 1, const std::size_t ku_li_MAX_CONCURRENCY_ = 0)
+	{
+		if (ku_li_WEIGHT_ == 0)
+		{
+			throw std::invalid_argument("The weight of an executor must be at least 1");
+		} // end if
+
+		Guard_t guard(m_mtx_executors);
+
+		for (const auto& kp_executor : m_vect_executors)
+		{
+			if (kp_executor->m_str_name == k_str_name_)
+			{
+				throw std::invalid_argument("The pool already has an executor named " + k_str_name_);
+			} // end if
+		} // end for kp_executor
+
+		m_vect_executors.push_back(std::make_shared<Executor_t>(k_str_name_, ku_li_WEIGHT_, ku_li_MAX_CONCURRENCY_, &m_arena_executors));
+
+		return Executor(this, m_vect_executors.back());
+	} // end method Create_Executor
+
+
+	///<summary>
+	/// Returns a handle to the executor named <paramref name="k_str_name_"/>.
+	///</summary>
+	///<exception cref="std::out_of_range">Thrown if the pool has no executor of that name.</exception>
+	Executor Get_Executor(const std::string& k_str_name_)
+	{
+		Guard_t guard(m_mtx_executors);
+
+		for (const auto& kp_executor : m_vect_executors)
+		{
+			if (kp_executor->m_str_name == k_str_name_)
+			{
+				return Executor(this, kp_executor);
+			} // end if
+		} // end for kp_executor
+
+		throw std::out_of_range("The pool has no executor named " + k_str_name_);
+	} // end method Get_Executor
+
+
+	///<summary>
+	/// Creates a strand, whose jobs are executed one after another by the threads of this pool.
+	///</summary>
+	///<param name="kb_STICKY_">Whether or not the strand executes batches of jobs on the thread that took it, see <see cref="Strand"/>.</param>
+	///<returns>A handle to the strand.</returns>
+	Strand Create_Strand(const bool kb_STICKY_ = false)
+	{
+		return Strand(this, std::make_shared<Strand_t>(kb_STICKY_));
+	} // end method Create_Strand
+
+
+	///<summary>
+	/// Returns a handle to the strand of <paramref name="k_key_"/>, all jobs added through it with the same key are executed one after another.
+	///</summary>
+	///<param name="k_key_">The key, for instance the id of a connection or a shard.</param>
+	///<returns>A handle to the strand.</returns>
+	///<remarks>
+	/// Keys are hashed onto a fixed set of <see cref="M_N_KEYED_STRANDS"/> strands, which are never sticky, so keys don't 
+	/// have to be registered or released. Keys sharing a strand are serialized with each other as well, 
+	/// use <see cref="Create_Strand"/> for a strand of its own.
+	///</remarks>
+	template <class Key, class Hash = std::hash<Key>>
+	Strand Get_Strand(const Key& k_key_)
+	{
+		std::call_once(m_once_strands, [this](void)
+		{
+			m_vect_keyed_strands.reserve(M_N_KEYED_STRANDS);
+
+			for (std::size_t i = 0; i < M_N_KEYED_STRANDS; i++)
+			{
+				m_vect_keyed_strands.push_back(std::make_shared<Strand_t>(false));
+			} // end for i
+		}); // end lambda
+
+		return Strand(this, m_vect_keyed_strands[Hash()(k_key_) % M_N_KEYED_STRANDS]);
+	} // end method Get_Strand
+
+
+	///<summary>
+	/// Executes one pending job of this pool on the calling thread, if there is one, without blocking.
+	///</summary>
+	///<returns>True if a job was executed, false if no job was found.</returns>
+	///<remarks>
+	/// Any thread may call this, a thread outside the pool takes jobs from the shared queue and in work stealing mode
+	/// steals from the deques of the threads of the pool. Exceptions thrown by the job are reported like those of any other job.
+	///</remarks>
+	bool Run_Pending_Once(void)
+	{
+		return try_run_one();
+	} // end method Run_Pending_Once
+
+
+	///<summary>
+	/// Blocks until <paramref name="future_"/> is ready, executing pending jobs of this pool on the calling thread in the meantime.
+	///</summary>
+	///<param name="future_">The future to wait for, its result is left in it.</param>
+	///<exception cref="std::future_error">Thrown if the future has no shared state.</exception>
+	///<remarks>
+	/// A job waiting for a future of another job of the pool this way keeps its thread busy with other jobs, including the one 
+	/// it waits for, instead of blocking it, so nested parallelism cannot run out of threads. While no job is found, the calling 
+	/// thread blocks on the future, and looks for jobs again every <see cref="M_HELP_POLL_INTERVAL"/>.
+	///</remarks>
+	template <class T>
+	void Wait_And_Help(const Future<T>& future_)
+	{
+		if (future_.valid() == false)
+		{
+			throw std::future_error(std::future_errc::no_state);
+		} // end if
+
+		while (future_.is_ready() == false)
+		{
+			if (try_run_one() == false)
+			{
+				future_.wait_for(M_HELP_POLL_INTERVAL);
+			} // end if
+		} // end while
+	} // end method Wait_And_Help
+
+
+	///<summary>
+	/// Terminates all threads currently running in the thread pool. If <paramref name="b_SYNC_FIRST_"/> 
+	/// is set, the pool will sychronize before terminating the running threads.
+	///</summary>
+	///<param name="b_SYNC_FIRST_">Whether or not to block and synchronize before terminating.</param>
+	///<remarks>
+	/// The job queue will not be cleared by this function, an explicit call to Empty_Job_Queue is required.
+	/// Pending jobs are executed once threads are started again. Use <see cref="Shutdown"/> to drain
+	/// or discard the pending jobs while terminating.
+	///</remarks>
+	void Kill_All(const bool b_SYNC_FIRST_ = false)
+	{
+		if (b_SYNC_FIRST_ == true)
+		{
+			Synchronize();
+		} // end if
+
+		// the pool must not grow again while it is shut down
+		stop_manager();
+
+		Guard_t guard(m_mtx_resize);
+
+		stop_threads(0);
+	} // end method Stop
+
+
+	///<summary>
+	/// Terminates all threads, executing or discarding the pending jobs as given by <paramref name="ke_POLICY_"/>.
+	///</summary>
+	///<param name="ke_POLICY_">
+	/// What to do with pending jobs, TP_SHUTDOWN_DEADLINE executes pending jobs 
+	/// for at most <see cref="Settings::dur_shutdown_timeout"/>.
+	///</param>
+	///<returns>
+	/// True if no pending job was discarded, false if jobs were discarded or the calling thread belongs to this pool.
+	///</returns>
+	///<remarks>
+	/// Parked threads are woken up immediately and jobs that are already executing always complete.
+	/// If no threads are running, pending jobs are drained by the calling thread instead.
+	/// Like after Kill_All, threads can be started again afterwards. The destructor shuts the pool down
+	/// with the policy given by <see cref="Settings::e_shutdown"/>.
+	///</remarks>
+	bool Shutdown(const SHUTDOWN_POLICIES ke_POLICY_)
+	{
+		return Shutdown(ke_POLICY_, m_dur_shutdown_timeout);
+	} // end method Shutdown
+
+
+	///<summary>
+	/// Terminates all threads, like <see cref="Shutdown(SHUTDOWN_POLICIES)"/>, giving pending 
+	/// jobs at most <paramref name="k_timeout_"/> with TP_SHUTDOWN_DEADLINE.
+	///</summary>
+	///<param name="ke_POLICY_">What to do with pending jobs.</param>
+	///<param name="k_timeout_">The time pending jobs are given with TP_SHUTDOWN_DEADLINE.</param>
+	///<returns>
+	/// True if no pending job was discarded, false if jobs were discarded or the calling thread belongs to this pool.
+	///</returns>
+	template <class Rep, class Period>
+	bool Shutdown(const SHUTDOWN_POLICIES ke_POLICY_, const std::chrono::duration<Rep, Period>& k_timeout_)
+	{
+		// a thread of the pool cannot wait for itself to terminate
+		if (ts_p_pool == this)
+		{
+			return false;
+		} // end if
+
+		return shutdown(ke_POLICY_, std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(k_timeout_));
+	} // end method Shutdown
+
+
+	///<summary>
+	/// Removes all pending jobs from the queue and the deques of all threads and destroys them.
+	///</summary>
+	void Empty_Job_Queue(void)
+	{
+		for (auto& p_node : m_vect_nodes)
+		{
+			for (std::size_t i = 0; i < JOB_PRIORITIES::TP_N_PRIORITIES; i++)
+			{
+				if (uses_ring() == true)
+				{
+					Job_t job;
+
+					while (p_node->m_arr_p_ring_tasks[i]->Try_Pop(job) == true)
+					{
+						job = nullptr;
+						ma_u_li_ndiscarded++;
+					} // end while
+				} // end if
+
+				std::size_t u_li_ndiscarded = 0;
+
+				// with ring buffers, the locked queue holds the overflow of forced jobs, 
+				// its jobs are destroyed without holding the lock, destroying a job may add another one,
+				// while the new queue allocates from the arena of the node, which requires the lock
+				{
+					Lock_t lock(p_node->m_mtx_tasks);
+					Job_Queue_t q_discarded(Arena_Allocator<Job_t>(&p_node->m_arena_tasks));
+
+					q_discarded.swap(p_node->m_arr_q_tasks[i]);
+					u_li_ndiscarded = q_discarded.size();
+					lock.unlock();
+				} // end Lock_t
+
+				// the jobs count as queued until they are destroyed, and only then as discarded
+				p_node->ma_arr_u_li_nqueued[i].fetch_sub(u_li_ndiscarded);
+				ma_u_li_ndiscarded += u_li_ndiscarded;
+			} // end for i
+		} // end for p_node
+
+		// all producers blocked on a full queue can make progress now
+		{
+			Guard_t guard(m_mtx_space);
+		} // end Guard_t
+
+		m_cv_space.notify_all();
+
+		for (auto p_worker : *ma_p_workers.load(std::memory_order_acquire))
+		{
+			Job_t* p_job = nullptr;
+
+			while (p_worker->m_deque_jobs.Empty() == false)
+			{
+				if (p_worker->m_deque_jobs.Steal(p_job) == true)
+				{
+					delete_job(p_job);
+					ma_u_li_ndiscarded++;
+				} // end if
+			} // end while
+		} // end for p_worker
+
+		// the jobs of executors are discarded last, their tokens in the queues are gone, 
+		// and only tokens are counted as jobs of the pool
+		std::vector<Job_t> vect_discarded;
+		Lock_t lock(m_mtx_executors);
+
+		for (auto& p_executor : m_vect_executors)
+		{
+			for (; p_executor->m_q_jobs.empty() == false; p_executor->m_q_jobs.pop())
+			{
+				vect_discarded.push_back(std::move(p_executor->m_q_jobs.front()));
+			} // end for
+		} // end for p_executor
+
+		mu_li_executor_runnable = 0;
+		lock.unlock();
+
+		vect_discarded.clear();
+
+		wake_synchronizers();
+	} // end method Empty_Job_Queue
+
+
+	///<summary>
+	/// Blocks until all pending jobs have been completed.
+	///</summary>
+	///<returns>
+	/// True on successful completion of all pending jobs.
+	/// False if no threads are running.
+	///</returns>
+	///<remarks>
+	/// This waits for every job of the pool, including jobs added by other callers, which is rarely what 
+	/// a caller needs. Use a <see cref="Task_Group"/> to wait only for a specific set of jobs.
+	/// The calling thread is blocked rather than polling, it is woken up whenever a thread runs out of work.
+	///</remarks>
+	bool Synchronize(void) const
+	{
+		if (ma_u_li_nrunning == 0)
+		{
+			std::cerr << "ThreadPool::Synchronize invoked with 0 running threads! Did you call Start_All?" << std::endl;
+			return false;
+		} // end if
+
+		wait_pending(nullptr);
+
+		return true;
+	} // end method Synchronize
+
+
+	///<summary>
+	/// Accessor for the number of threads running.
+	///</summary>
+	///<returns>The number of threads currently running.</returns>
+	std::size_t N_Threads_Running(void) const noexcept
+	{
+		return ma_u_li_nrunning;
+	} // end method N_Threads_Running
+
+
+	///<summary>
+	/// Accessor for the number of shared queues, one per NUMA node if node queues are used.
+	///</summary>
+	///<returns>The number of shared queues, at least 1.</returns>
+	std::size_t N_Nodes(void) const noexcept
+	{
+		return m_vect_nodes.size();
+	} // end method N_Nodes
+
+
+	///<summary>
+	/// Accessor for the maximum number of jobs the shared queue of every node holds before producers are blocked, all priorities together.
+	///</summary>
+	///<remarks>
+	/// The locked queue holds Settings::u_li_capacity jobs of any priorities. The ring buffer backend preallocates a ring
+	/// of Settings::u_li_capacity jobs, rounded up to a power of two, for every priority, which blocks producers of its priority 
+	/// once it is full, so the queue holds and allocates TP_N_PRIORITIES times that many jobs.
+	/// Jobs added by Add_Job_Force are never blocked, they exceed the capacity instead.
+	///</remarks>
+	///<returns>The capacity of the shared queue of every node.</returns>
+	std::size_t Capacity(void) const noexcept
+	{
+		return uses_ring() == true ? JOB_PRIORITIES::TP_N_PRIORITIES * mu_li_capacity : mu_li_capacity;
+	} // end method Capacity
+
+
+	///<summary>
+	/// Accessor for the number of jobs not completed.
+	///</summary>
+	///<returns>The number of jobs that remain in the queue and the deques of all threads.</returns>
+	std::size_t N_Jobs_Remaining(void) const noexcept
+	{
+		std::size_t u_li_njobs = 0;
+
+		for (auto p_worker : *ma_p_workers.load(std::memory_order_acquire))
+		{
+			u_li_njobs += p_worker->m_deque_jobs.Size();
+		} // end for p_worker
+
+		return u_li_njobs + n_queued();
+	} // end method N_Jobs_Remaining
+
+
+	///<summary>
+	/// Returns whether or not an exception pointer was queued for processing.
+	///</summary>
+	///<returns>True iff there are exceptions waiting for processing, otherwise false.</returns>
+	bool Has_Exceptions(void) const noexcept
+	{
+		Guard_t guard(m_mtx_exception);
+
+		return m_q_exception.Empty() == false;
+	} // end method Has_Exceptions
+
+
+	///<summary>
+	/// Returns a list of all running threads and their current states at the time of invocation.
+	///</summary>
+	///<returns>A vector of all thread states, indexed by the id of the thread within the thread pool.</returns>
+	std::vector<THREAD_SIGNALS> Thread_States(void) const
+	{
+		Guard_t guard(m_mtx_threads);
+		std::vector<THREAD_SIGNALS> vect_states;
+
+		vect_states.reserve(ma_u_li_nrunning);
+
+		for (std::size_t i = 0; i < ma_u_li_nrunning; i++)
+		{
+			vect_states.push_back(m_vect_workers[i]->ma_e_signal.load(std::memory_order_relaxed));
+		} // end for i
+
+		return vect_states;
+	} // end method Thread_States
+
+
+	///<summary>
+	/// Returns the state of the thread with id <paramref name="ku_li_ID_"/> at the time of invocation.
+	///</summary>
+	///<param name="ku_li_ID_">The id of the thread within the thread pool.</param>
+	///<returns>The state of the thread.</returns>
+	///<exception cref="std::out_of_range">Thrown if no thread with the given id is running.</exception>
+	THREAD_SIGNALS Thread_State(const std::size_t ku_li_ID_) const
+	{
+		Guard_t guard(m_mtx_threads);
+
+		if (ku_li_ID_ >= ma_u_li_nrunning)
+		{
+			throw std::out_of_range("ThreadPool::Thread_State: no thread with the given id is running");
+		} // end if
+
+		return m_vect_workers[ku_li_ID_]->ma_e_signal.load(std::memory_order_relaxed);
+	} // end method Thread_State
+
+
+	///<summary>
+	/// Sets the callable every thread of the pool invokes with its id when it starts, before it executes any job.
+	///</summary>
+	///<param name="fn_on_start_">The callable, an empty function to remove it.</param>
+	///<remarks>
+	/// Threads started before the call keep the callable they started with. Use this to set up resources every thread 
+	/// needs once, see <see cref="Emplace_Worker_Context"/>. Exceptions thrown by the callable are reported like those of any job.
+	///</remarks>
+	void On_Thread_Start(std::function<void(std::size_t)> fn_on_start_)
+	{
+		Guard_t guard(m_mtx_threads);
+
+		m_fn_on_thread_start = std::move(fn_on_start_);
+	} // end method On_Thread_Start
+
+
+	///<summary>
+	/// Sets the callable every thread of the pool invokes with its id when it terminates, after it executed its last job.
+	///</summary>
+	///<param name="fn_on_stop_">The callable, an empty function to remove it.</param>
+	///<remarks>
+	/// Threads started before the call keep the callable they started with. The context of the thread is destroyed 
+	/// right after the callable returns, on the same thread. Exceptions thrown by the callable are reported like those of any job.
+	///</remarks>
+	void On_Thread_Stop(std::function<void(std::size_t)> fn_on_stop_)
+	{
+		Guard_t guard(m_mtx_threads);
+
+		m_fn_on_thread_stop = std::move(fn_on_stop_);
+	} // end method On_Thread_Stop
+
+
+	///<summary>
+	/// Returns the id of the calling thread within this pool.
+	///</summary>
+	///<returns>The id, or no value if the calling thread does not belong to this pool.</returns>
+	std::optional<std::size_t> Current_Worker(void) const noexcept
+	{
+		if (ts_p_pool != this)
+		{
+			return std::nullopt;
+		} // end if
+
+		return ts_p_worker->mu_li_id;
+	} // end method Current_Worker
+
+
+	///<summary>
+	/// Returns the context of the calling thread of this pool, a default constructed <typeparamref name="T"/> if it has none yet.
+	///</summary>
+	///<returns>The context, which lives until the thread terminates and is only ever accessed by that thread.</returns>
+	///<exception cref="std::logic_error">
+	/// Thrown if the calling thread does not belong to this pool, or has no context and <typeparamref name="T"/> is not default constructible.
+	///</exception>
+	///<exception cref="std::bad_cast">Thrown if the thread has a context of another type.</exception>
+	template <class T>
+	T& Worker_Context(void)
+	{
+		Worker_t& worker = current_worker();
+
+		if (worker.mp_context == nullptr)
+		{
+			if constexpr (std::is_default_constructible<T>::value == true)
+			{
+				return Emplace_Worker_Context<T>();
+			} // end if
+			else
+			{
+				throw std::logic_error("The calling thread has no context");
+			} // end else
+		} // end if
+
+		if (*worker.mp_context_type != typeid(T))
+		{
+			throw std::bad_cast();
+		} // end if
+
+		return *static_cast<T*>(worker.mp_context.get());
+	} // end method Worker_Context
+
+
+	///<summary>
+	/// Replaces the context of the calling thread of this pool with a <typeparamref name="T"/> constructed from <paramref name="args_"/>.
+	///</summary>
+	///<param name="args_">The arguments to construct the context with.</param>
+	///<returns>The context, see <see cref="Worker_Context"/>.</returns>
+	///<exception cref="std::logic_error">Thrown if the calling thread does not belong to this pool.</exception>
+	///<remarks>
+	/// The context of a thread may be of any type, including types that cannot be copied or moved, 
+	/// typically scratch buffers, random number generators or handles only valid on the thread that opened them.
+	///</remarks>
+	template <class T, class... Args>
+	T& Emplace_Worker_Context(Args&&... args_)
+	{
+		Worker_t& worker = current_worker();
+
+		// the old context is destroyed first, and the thread is left without context if the new one throws
+		worker.mp_context.reset();
+		worker.mp_context_type = nullptr;
+		worker.mp_context = std::make_shared<T>(std::forward<Args>(args_)...);
+		worker.mp_context_type = &typeid(T);
+
+		return *static_cast<T*>(worker.mp_context.get());
+	} // end method Emplace_Worker_Context
+
+
+	///<summary>
+	/// Returns a snapshot of the metrics of this pool, since the pool was initialized.
+	///</summary>
+	///<returns>The metrics at the time of invocation.</returns>
+	///<remarks>
+	/// The pool keeps running while the snapshot is taken, so counters of different threads 
+	/// may be read at slightly different times. Jobs still executing are not counted yet.
+	/// Only available if the configuration enables metrics, see <see cref="Thread_Pool_Config::M_METRICS"/>.
+	///</remarks>
+	Pool_Stats Stats(void) const
+	{
+		static_assert(M_METRICS == true, "Stats requires a configuration with M_METRICS");
+
+		const Worker_Table_t& k_workers = *ma_p_workers.load(std::memory_order_acquire);
+		Pool_Stats stats;
+
+		stats.vect_workers.resize(k_workers.size());
+
+		for (std::size_t i = 0; i < k_workers.size(); i++)
+		{
+			k_workers[i]->m_metrics.Snapshot(stats.vect_workers[i]);
+			stats.hist_latency.Merge(stats.vect_workers[i].hist_latency);
+			stats.hist_execution.Merge(stats.vect_workers[i].hist_execution);
+		} // end for i
+
+		m_metrics_external.Snapshot(stats.external);
+		stats.hist_latency.Merge(stats.external.hist_latency);
+		stats.hist_execution.Merge(stats.external.hist_execution);
+
+		for (const auto& p_node : m_vect_nodes)
+		{
+			stats.u_li_queue_high_water = std::max(stats.u_li_queue_high_water, p_node->ma_u_li_high_water.load(std::memory_order_relaxed));
+		} // end for p_node
+
+		stats.u_li_nqueued = n_queued();
+
+		return stats;
+	} // end method Stats
+
+
+	///<summary>
+	/// Wraps <paramref name="fn_"/> into a job shown as <paramref name="kp_LABEL_"/> in traces.
+	///</summary>
+	///<param name="kp_LABEL_">The label, the string is not copied and has to outlive every trace the job appears in, usually a literal.</param>
+	///<param name="fn_">The callable to execute.</param>
+	///<returns>The job, which can be added like any other callable.</returns>
+	///<remarks>Without THREAD_POOL_ENABLE_TRACING, the label is ignored.</remarks>
+	template <class F>
+	static Job_t Labeled_Job(const char* kp_LABEL_, F&& fn_)
+	{
+		Job_t fn_job(std::forward<F>(fn_));
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+		fn_job.Set_Label(kp_LABEL_);
+#else
+		static_cast<void>(kp_LABEL_);
+#endif
+
+		return fn_job;
+	} // end method Labeled_Job
+
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+	///<summary>
+	/// Starts recording when jobs are added, start and end executing, are stolen, and when threads park and wake up.
+	///</summary>
+	///<remarks>
+	/// Every thread of the pool records into a ring of its own, threads outside the pool share one ring. 
+	/// Each ring keeps the last <see cref="M_TRACE_BUFFER_SIZE"/> events, older events are overwritten. 
+	/// Events recorded before tracing was stopped are kept, so tracing can be started and stopped repeatedly.
+	///</remarks>
+	void Start_Tracing(void) noexcept
+	{
+		ma_b_tracing.store(true, std::memory_order_relaxed);
+	} // end method Start_Tracing
+
+
+	///<summary>
+	/// Stops recording events, jobs that are executing when tracing is stopped still record their end.
+	///</summary>
+	void Stop_Tracing(void) noexcept
+	{
+		ma_b_tracing.store(false, std::memory_order_relaxed);
+	} // end method Stop_Tracing
+
+
+	///<summary>
+	/// Returns whether or not events are being recorded.
+	///</summary>
+	bool Tracing(void) const noexcept
+	{
+		return ma_b_tracing.load(std::memory_order_relaxed);
+	} // end method Tracing
+
+
+	///<summary>
+	/// Writes the recorded events to <paramref name="os_"/> in the Chrome trace event format, which
+	/// chrome://tracing and the Perfetto UI open directly.
+	///</summary>
+	///<param name="os_">The stream to write the JSON document to.</param>
+	///<remarks>
+	/// Every thread of the pool is shown as a track of its own, threads outside the pool share track 0. Executing a job
+	/// and being parked are shown as slices, adding and stealing a job as instant events, and every job added while 
+	/// tracing is on is connected to its execution by a flow arrow. The pool keeps running while the events are
+	/// copied, events overwritten meanwhile are left out, as are ends whose start was already overwritten.
+	///</remarks>
+	void Write_Trace(std::ostream& os_) const
+	{
+		const Worker_Table_t& k_workers = *ma_p_workers.load(std::memory_order_acquire);
+		std::vector<Trace_Buffer::Event> vect_events;
+		bool b_first = true;
+
+		os_ << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+		for (std::size_t i = 0; i <= k_workers.size(); i++)
+		{
+			const std::size_t ku_li_TID = i;
+			const Trace_Buffer& k_trace = i == 0 ? m_trace_external : k_workers[i - 1]->m_trace;
+			std::size_t u_li_depth = 0;
+
+			vect_events.clear();
+			k_trace.Snapshot(vect_events);
+
+			write_trace_prefix(os_, b_first, "thread_name", "M", ku_li_TID, 0);
+
+			if (i == 0)
+			{
+				os_ << ",\"args\":{\"name\":\"external\"}}";
+			} // end if
+			else
+			{
+				os_ << ",\"args\":{\"name\":\"worker " << i - 1 << "\"}}";
+			} // end else
+
+			for (const auto& k_event : vect_events)
+			{
+				switch (k_event.u_type)
+				{
+				case TRACE_EVENTS::TP_TRACE_ENQUEUE:
+					write_trace_prefix(os_, b_first, "enqueue", "i", ku_li_TID, k_event.u_li_ns);
+					os_ << ",\"s\":\"t\"";
+					write_trace_args(os_, k_event, "priority");
+
+					if (k_event.u_li_id != 0)
+					{
+						write_trace_prefix(os_, b_first, "job", "s", ku_li_TID, k_event.u_li_ns);
+						os_ << ",\"id\":" << k_event.u_li_id << '}';
+					} // end if
+					break;
+				case TRACE_EVENTS::TP_TRACE_START:
+					u_li_depth++;
+					write_trace_prefix(os_, b_first, k_event.p_label != nullptr ? k_event.p_label : "job", "B", ku_li_TID, k_event.u_li_ns);
+					write_trace_args(os_, k_event, nullptr);
+
+					if (k_event.u_li_id != 0)
+					{
+						write_trace_prefix(os_, b_first, "job", "f", ku_li_TID, k_event.u_li_ns);
+						os_ << ",\"bp\":\"e\",\"id\":" << k_event.u_li_id << '}';
+					} // end if
+					break;
+				case TRACE_EVENTS::TP_TRACE_STEAL:
+					write_trace_prefix(os_, b_first, "steal", "i", ku_li_TID, k_event.u_li_ns);
+					os_ << ",\"s\":\"t\"";
+					write_trace_args(os_, k_event, "victim");
+					break;
+				case TRACE_EVENTS::TP_TRACE_PARK:
+					u_li_depth++;
+					write_trace_prefix(os_, b_first, "parked", "B", ku_li_TID, k_event.u_li_ns);
+					os_ << '}';
+					break;
+				default:
+					// the start of the slice may have been overwritten
+					if (u_li_depth != 0)
+					{
+						u_li_depth--;
+						write_trace_prefix(os_, b_first, nullptr, "E", ku_li_TID, k_event.u_li_ns);
+						os_ << '}';
+					} // end if
+					break;
+				} // end switch
+			} // end for k_event
+		} // end for i
+
+		os_ << "]}\n";
+	} // end method Write_Trace
+#endif
+
+
+	///<summary>
+	/// Accessor for the last exception that has occurred, exceptions are returned in order of occurrence.
+	///</summary>
+	///<returns>An exception pointer to the next exception, or a nullptr if no exceptions are queued.</returns>
+	std::exception_ptr Last_Exception(void)
+	{
+		Guard_t guard(m_mtx_exception);
+		std::exception_ptr exptr_exception;
+
+		m_q_exception.Try_Pop(exptr_exception);
+
+		return exptr_exception;
+	} // end method Last_Exception
+
+
+protected:
+	///<summary>
+	/// Thread main function. Threads will idle until work is available 
+	/// and they have not received a sigterm from the main thread.
+	///</summary>
+	///<param name="ku_li_MY_ID_">The id of this thread within the thread pool.</param>
+	///<param name="k_fn_on_start_">The callable invoked before the first job, if any.</param>
+	///<param name="k_fn_on_stop_">The callable invoked after the last job, if any.</param>
+	void idle_thread(const std::size_t ku_li_MY_ID_, const std::function<void(std::size_t)>& k_fn_on_start_, const std::function<void(std::size_t)>& k_fn_on_stop_)
+	{
+		auto b_run = true;
+
+		ts_p_pool = this;
+		ts_p_worker = (*ma_p_workers.load(std::memory_order_acquire))[ku_li_MY_ID_];
+
+		// pinning is best effort, the thread keeps running unpinned if the CPU is not available
+		if (m_vect_placement.empty() == false)
+		{
+			CPU_Topology::Pin_Current_Thread(ts_p_worker->mu_li_cpu);
+		} // end if
+
+		run_thread_hook(k_fn_on_start_, ku_li_MY_ID_);
+
+		while (b_run == true)
+		{
+			std::chrono::steady_clock::time_point tp_idle_since;
+
+			if constexpr (M_METRICS == true)
+			{
+				tp_idle_since = std::chrono::steady_clock::now();
+			} // end if
+
+			auto fn_job = get_work();
+
+			if constexpr (M_METRICS == true)
+			{
+				ts_p_worker->m_metrics.Add(ts_p_worker->m_metrics.ma_u_li_idle_ns, Metrics_t::Nanoseconds(std::chrono::steady_clock::now() - tp_idle_since));
+			} // end if
+
+			// get_work only hands out an empty job when this thread was told to terminate
+			if (!fn_job)
+			{
+				break;
+			} // end if
+
+			execute(fn_job);
+
+			switch (ts_p_worker->ma_e_signal.load(std::memory_order_acquire))
+			{
+			case THREAD_SIGNALS::TP_SIGTERM:
+				b_run = false;
+				break;
+			default:
+				break;
+			} // end switch
+		} // end while
+
+		// jobs left in the deque of a retired thread are stolen by the remaining threads
+		if (ts_p_worker->m_deque_jobs.Empty() == false)
+		{
+			wake_all();
+		} // end if
+
+		run_thread_hook(k_fn_on_stop_, ku_li_MY_ID_);
+
+		// the resources of the thread are released by the thread itself, a restarted thread starts without context
+		ts_p_worker->mp_context.reset();
+		ts_p_worker->mp_context_type = nullptr;
+
+		ts_p_worker->ma_e_signal.store(THREAD_SIGNALS::TP_TERMINATING, std::memory_order_release);
+	} // end idle_thread
+
+
+	///<summary>
+	/// Invokes <paramref name="k_fn_hook_"/> with <paramref name="ku_li_ID_"/> if it is set, and reports the exception it throws, if any.
+	///</summary>
+	void run_thread_hook(const std::function<void(std::size_t)>& k_fn_hook_, const std::size_t ku_li_ID_) noexcept
+	{
+		if (!k_fn_hook_)
+		{
+			return;
+		} // end if
+
+		try
+		{
+			k_fn_hook_(ku_li_ID_);
+		} // end try
+		catch (...)
+		{
+			report_exception(std::current_exception());
+		} // end catch all
+	} // end method run_thread_hook
+
+
+	///<summary>
+	/// Returns the state of the calling thread of this pool.
+	///</summary>
+	///<exception cref="std::logic_error">Thrown if the calling thread does not belong to this pool.</exception>
+	Worker_t& current_worker(void) const
+	{
+		if (ts_p_pool != this)
+		{
+			throw std::logic_error("The calling thread does not belong to this pool");
+		} // end if
+
+		return *ts_p_worker;
+	} // end method current_worker
+
+
+	///<summary>
+	/// Creates a task invoking <paramref name="fn_"/> with the arguments <paramref name="args_"/> and storing the result in <paramref name="promise_"/>.
+	///</summary>
+	///<param name="promise_">The promise receiving the result, a task that is destroyed without being executed breaks it.</param>
+	///<param name="fn_">The callable to invoke, it is decay-copied (or moved) into the task.</param>
+	///<param name="args_">The arguments to invoke the callable with, they are decay-copied (or moved) into the task.</param>
+	///<returns>A callable to be stored in a job.</returns>
+	template <class R, class F, class... Args>
+	static auto make_task(Promise_t<R>&& promise_, F&& fn_, Args&&... args_)
+	{
+		// the shared state of the future is the only allocation as long as the callable 
+		// and its arguments fit into the job next to the promise
+		return [promise = std::move(promise_), fn = std::forward<F>(fn_), tup_args = std::make_tuple(std::forward<Args>(args_)...)](void) mutable
+		{
+			promise.Run([&](void) -> R { return std::apply(std::move(fn), std::move(tup_args)); });
+		}; // end lambda
+	} // end method make_task
+
+
+	///<summary>
+	/// Creates a task like <see cref="make_task"/> that is skipped once a stop is requested through <paramref name="token_"/>,
+	/// and passes the token to the callable if it accepts one in front of the arguments.
+	///</summary>
+	template <class R, class F, class... Args>
+	static auto make_stoppable_task(Promise_t<R>&& promise_, Stop_Token token_, F&& fn_, Args&&... args_)
+	{
+		return [promise = std::move(promise_), token = std::move(token_), fn = std::forward<F>(fn_), tup_args = std::make_tuple(std::forward<Args>(args_)...)](void) mutable
+		{
+			// a tombstone, the promise breaks once the job is destroyed
+			if (token.Stop_Requested() == true)
+			{
+				return;
+			} // end if
+
+			promise.Run([&](void) -> R
+			{
+				if constexpr (std::is_invocable<std::decay_t<F>, Stop_Token, std::decay_t<Args>...>::value == true)
+				{
+					return std::apply(std::move(fn), std::tuple_cat(std::make_tuple(token), std::move(tup_args)));
+				} // end if
+				else
+				{
+					return std::apply(std::move(fn), std::move(tup_args));
+				} // end else
+			}); // end lambda
+		}; // end lambda
+	} // end method make_stoppable_task
+
+#ifdef __cpp_lib_coroutine
+
+	///<summary>
+	/// Coroutine running <paramref name="task_"/> on a thread of <paramref name="p_pool_"/> and storing its result in <paramref name="promise_"/>.
+	///</summary>
+	///<remarks>The coroutine owns the task and the promise, and destroys itself once it completes.</remarks>
+	template <class T>
+	static Detached_t spawn(BasicThreadPool* p_pool_, Task<T> task_, Promise_t<T> promise_, const JOB_PRIORITIES ke_PRIORITY_)
+	{
+		try
+		{
+			co_await p_pool_->Schedule(ke_PRIORITY_);
+
+			if constexpr (std::is_void<T>::value == true)
+			{
+				co_await task_;
+				promise_.mp_state->Set_Value(true);
+			} // end if
+			else
+			{
+				promise_.mp_state->Set_Value(co_await task_);
+			} // end else
+		} // end try
+		catch (...)
+		{
+			promise_.mp_state->Set_Exception(std::current_exception());
+		} // end catch all
+	} // end method spawn
+
+#endif
+
+
+	///<summary>
+	/// Accessor for the counters of the calling thread, which are shared by all threads outside the pool.
+	/// Only available if the configuration enables metrics.
+	///</summary>
+	Metrics_t& thread_metrics(void) noexcept
+	{
+		return ts_p_pool == this ? ts_p_worker->m_metrics : m_metrics_external;
+	} // end method thread_metrics
+
+
+	///<summary>
+	/// Executes <paramref name="fn_job_"/>, destroys it and counts it as completed by the calling thread.
+	/// Exceptions thrown by the job are reported and do not propagate, see <see cref="report_exception"/>.
+	///</summary>
+	///<param name="fn_job_">The job to execute, it is empty afterwards.</param>
+	void execute(Job_t& fn_job_)
+	{
+		std::chrono::steady_clock::time_point tp_start;
+
+		if constexpr (M_METRICS == true)
+		{
+			Metrics_t& metrics = thread_metrics();
+
+			tp_start = std::chrono::steady_clock::now();
+			metrics.Record(metrics.ma_arr_u_li_latency, Metrics_t::Nanoseconds(tp_start - fn_job_.Timestamp()));
+		} // end if
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+		// the end is recorded even if tracing is stopped meanwhile, so every start recorded has an end
+		const bool kb_TRACE = Tracing();
+		const std::uint64_t ku_li_TRACE_ID = fn_job_.Trace_Id();
+		const char* const kp_LABEL = fn_job_.Label();
+
+		if (kb_TRACE == true)
+		{
+			trace(TRACE_EVENTS::TP_TRACE_START, trace_now(), ku_li_TRACE_ID, kp_LABEL);
+		} // end if
+#endif
+
+		try
+		{
+			fn_job_();
+		} // end try
+		catch (...) // catch any kind of exception and alert the user
+		{
+			report_exception(std::current_exception());
+		} // end catch all
+
+		// the job has to be destroyed before it is reported as completed
+		fn_job_ = nullptr;
+
+		if constexpr (M_METRICS == true)
+		{
+			Metrics_t& metrics = thread_metrics();
+			const std::size_t ku_li_BUSY_NS = Metrics_t::Nanoseconds(std::chrono::steady_clock::now() - tp_start);
+
+			metrics.Record(metrics.ma_arr_u_li_execution, ku_li_BUSY_NS);
+			metrics.Add(metrics.ma_u_li_busy_ns, ku_li_BUSY_NS);
+			metrics.Add(metrics.ma_u_li_nexecuted, 1);
+		} // end if
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+		if (kb_TRACE == true)
+		{
+			trace(TRACE_EVENTS::TP_TRACE_END, trace_now(), ku_li_TRACE_ID, kp_LABEL);
+		} // end if
+#endif
+
+		if (ts_p_pool == this)
+		{
+			increment(ts_p_worker->ma_u_li_ncompleted);
+		} // end if
+		else
+		{
+			ma_u_li_ncompleted++;
+		} // end else
+	} // end method execute
+
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+	///<summary>
+	/// Returns the time passed since the pool was initialized, the time events are recorded at.
+	///</summary>
+	std::uint64_t trace_now(void) const noexcept
+	{
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_tp_timer_epoch).count());
+	} // end method trace_now
+
+
+	///<summary>
+	/// Records an event into the ring of the calling thread, or into the shared ring if it is not a thread of this pool.
+	///</summary>
+	///<param name="ke_EVENT_">The kind of the event.</param>
+	///<param name="ku_li_NS_">The time of the event, see <see cref="trace_now"/>.</param>
+	///<param name="ku_li_ID_">The id of the job the event is about, 0 if none.</param>
+	///<param name="kp_LABEL_">The label of the job, nullptr if none.</param>
+	///<param name="ku_ARG_">The priority of added jobs, or the thread stolen jobs were taken from.</param>
+	void trace(const TRACE_EVENTS ke_EVENT_, const std::uint64_t ku_li_NS_, const std::uint64_t ku_li_ID_, const char* kp_LABEL_, const std::uint32_t ku_ARG_ = 0)
+	{
+		const Trace_Buffer::Event k_EVENT{ ku_li_NS_, ku_li_ID_, kp_LABEL_, static_cast<std::uint32_t>(ke_EVENT_), ku_ARG_ };
+
+		if (ts_p_pool == this)
+		{
+			ts_p_worker->m_trace.Record(k_EVENT);
+		} // end if
+		else
+		{
+			Guard_t guard(m_mtx_trace);
+
+			m_trace_external.Record(k_EVENT);
+		} // end else
+	} // end method trace
+
+
+	///<summary>
+	/// Assigns the next trace id to <paramref name="fn_job_"/>, so its execution can be connected to where it was added.
+	///</summary>
+	void assign_trace_id(Job_t& fn_job_) noexcept
+	{
+		fn_job_.Set_Trace_Id(ma_u_li_trace_ids.fetch_add(1, std::memory_order_relaxed) + 1);
+	} // end method assign_trace_id
+
+
+	///<summary>
+	/// Writes the fields every trace event starts with, leaving the event open for more fields.
+	///</summary>
+	///<param name="os_">The stream to write to.</param>
+	///<param name="b_first_">Whether or not this is the first event, false afterwards.</param>
+	///<param name="kp_NAME_">The name of the event, nullptr to leave it out.</param>
+	///<param name="kp_PHASE_">The phase of the event.</param>
+	///<param name="ku_li_TID_">The track of the event.</param>
+	///<param name="ku_li_NS_">The time of the event, written in microseconds.</param>
+	static void write_trace_prefix(std::ostream& os_, bool& b_first_, const char* kp_NAME_, const char* kp_PHASE_, const std::size_t ku_li_TID_, const std::uint64_t ku_li_NS_)
+	{
+		os_ << (b_first_ == true ? "\n{" : ",\n{");
+		b_first_ = false;
+
+		if (kp_NAME_ != nullptr)
+		{
+			os_ << "\"name\":";
+			write_json_string(os_, kp_NAME_);
+			os_ << ',';
+		} // end if
+
+		os_ << "\"cat\":\"thread_pool\",\"ph\":\"" << kp_PHASE_ << "\",\"pid\":1,\"tid\":" << ku_li_TID_
+			<< ",\"ts\":" << ku_li_NS_ / 1000 << '.' << static_cast<char>('0' + ku_li_NS_ / 100 % 10)
+			<< static_cast<char>('0' + ku_li_NS_ / 10 % 10) << static_cast<char>('0' + ku_li_NS_ % 10);
+	} // end method write_trace_prefix
+
+
+	///<summary>
+	/// Writes the id, label and argument of <paramref name="k_event_"/> and closes the event.
+	///</summary>
+	///<param name="os_">The stream to write to.</param>
+	///<param name="k_event_">The event to write the arguments of.</param>
+	///<param name="kp_ARG_NAME_">The name of the argument of the event, nullptr if it has none.</param>
+	static void write_trace_args(std::ostream& os_, const Trace_Buffer::Event& k_event_, const char* kp_ARG_NAME_)
+	{
+		os_ << ",\"args\":{\"id\":" << k_event_.u_li_id;
+
+		if (k_event_.p_label != nullptr)
+		{
+			os_ << ",\"label\":";
+			write_json_string(os_, k_event_.p_label);
+		} // end if
+
+		if (kp_ARG_NAME_ != nullptr)
+		{
+			os_ << ",\"" << kp_ARG_NAME_ << "\":" << k_event_.u_arg;
+		} // end if
+
+		os_ << "}}";
+	} // end method write_trace_args
+
+
+	///<summary>
+	/// Writes <paramref name="kp_STRING_"/> as a quoted JSON string.
+	///</summary>
+	static void write_json_string(std::ostream& os_, const char* kp_STRING_)
+	{
+		static const char kc_arr_HEX[] = "0123456789abcdef";
+
+		os_ << '"';
+
+		for (const char* p_c = kp_STRING_; *p_c != '\0'; p_c++)
+		{
+			const unsigned char ku_c_C = static_cast<unsigned char>(*p_c);
+
+			if (ku_c_C == '"' || ku_c_C == '\\')
+			{
+				os_ << '\\' << *p_c;
+			} // end if
+			else if (ku_c_C < 0x20)
+			{
+				os_ << "\\u00" << kc_arr_HEX[ku_c_C >> 4] << kc_arr_HEX[ku_c_C & 0xF];
+			} // end else if
+			else
+			{
+				os_ << *p_c;
+			} // end else
+		} // end for p_c
+
+		os_ << '"';
+	} // end method write_json_string
+#endif
+
+
+	///<summary>
+	/// Passes an exception that escaped a job to the exception handler, or adds it to the exception queue if no handler is set.
+	///</summary>
+	///<param name="exptr_">The exception thrown by the job.</param>
+	///<remarks>
+	/// Jobs added by Submit and Task_Group store their exceptions in their future or group, so only 
+	/// exceptions of plain jobs arrive here. The handler is invoked without holding any lock, 
+	/// exceptions thrown by the handler itself are discarded. Adding to the queue never blocks.
+	///</remarks>
+	void report_exception(std::exception_ptr exptr_) noexcept
+	{
+		if (m_fn_exception_handler)
+		{
+			try
+			{
+				m_fn_exception_handler(std::move(exptr_));
+			} // end try
+			catch (...)
+			{
+			} // end catch all
+
+			return;
+		} // end if
+
+		try
+		{
+			m_q_exception.Push(std::move(exptr_));
+		} // end try
+		catch (const std::bad_alloc&)
+		{
+			// the exception is lost rather than terminating the thread
+		} // end catch
+	} // end method report_exception
+
+
+	///<summary>
+	/// Attempts to execute one queued job on the calling thread without blocking. A thread of this pool
+	/// looks for jobs like <see cref="find_job"/>, other threads take jobs from the shared queue and steal from deques.
+	///</summary>
+	///<returns>True if a job was executed, false if no job was found.</returns>
+	bool try_run_one(void)
+	{
+		Job_t job;
+		const bool kb_FOUND = ts_p_pool == this ? find_job(job) : 
+			try_pop_job(job) == true || (me_scheduling == SCHEDULING_MODES::TP_WORK_STEALING && try_steal_external(job) == true);
+
+		if (kb_FOUND == true)
+		{
+			execute(job);
+
+			// threads outside the pool never become idle in get_work
+			if (ts_p_pool != this)
+			{
+				wake_synchronizers();
+			} // end if
+		} // end if
+
+		return kb_FOUND;
+	} // end method try_run_one
+
+
+	///<summary>
+	/// Returns the number of values per chunk used to split a range of <paramref name="ku_li_COUNT_"/> values.
+	///</summary>
+	///<param name="ku_li_COUNT_">The number of values in the range.</param>
+	///<param name="ku_li_GRAIN_">The minimum number of values per chunk, 0 for no minimum.</param>
+	///<returns>The number of values per chunk, at least 1.</returns>
+	std::size_t chunk_size(const std::size_t ku_li_COUNT_, const std::size_t ku_li_GRAIN_) const noexcept
+	{
+		const std::size_t ku_li_NCHUNKS = std::max<std::size_t>(ma_u_li_nrunning, 1) * M_CHUNKS_PER_THREAD;
+
+		return std::max<std::size_t>({ ku_li_GRAIN_, (ku_li_COUNT_ + ku_li_NCHUNKS - 1) / ku_li_NCHUNKS, 1 });
+	} // end method chunk_size
+
+
+	///<summary>
+	/// Invokes <paramref name="fn_chunk_"/> for every chunk in [0, <paramref name="ku_li_NCHUNKS_"/>) using
+	/// the threads of this pool and blocks until all chunks have completed.
+	///</summary>
+	///<param name="ku_li_NCHUNKS_">The number of chunks.</param>
+	///<param name="fn_chunk_">The callable to invoke with the index of every chunk.</param>
+	///<remarks>
+	/// The first exception thrown by <paramref name="fn_chunk_"/> is rethrown once all chunks have completed.
+	/// The chunks of jobs the pool discarded without executing them, e.g. by Empty_Job_Queue, are run by the calling thread.
+	///</remarks>
+	template <class Chunk_Fn>
+	void run_chunks(const std::size_t ku_li_NCHUNKS_, Chunk_Fn& fn_chunk_)
+	{
+		if (ku_li_NCHUNKS_ == 0)
+		{
+			return;
+		} // end if
+
+		// nothing to distribute, avoid the overhead of jobs
+		if (ku_li_NCHUNKS_ == 1 || ma_u_li_nrunning == 0)
+		{
+			for (std::size_t i = 0; i < ku_li_NCHUNKS_; i++)
+			{
+				fn_chunk_(i);
+			} // end for i
+
+			return;
+		} // end if
+
+		Chunks_t<Chunk_Fn> chunks(ku_li_NCHUNKS_, fn_chunk_);
+
+		split_chunks(chunks, 0, ku_li_NCHUNKS_);
+
+		std::exception_ptr exptr_first = wait_helping(chunks.m_latch);
+
+		// no job refers to the chunks anymore
+		for (const auto& k_pair_range : chunks.m_vect_discarded)
+		{
+			for (std::size_t i = k_pair_range.first; i < k_pair_range.second; i++)
+			{
+				try
+				{
+					fn_chunk_(i);
+				} // end try
+				catch (...)
+				{
+					if (!exptr_first)
+					{
+						exptr_first = std::current_exception();
+					} // end if
+				} // end catch all
+			} // end for i
+		} // end for k_pair_range
+
+		if (exptr_first)
+		{
+			std::rethrow_exception(exptr_first);
+		} // end if
+	} // end method run_chunks
+
+
+	///<summary>
+	/// Invokes <paramref name="fn_chunk_"/> for every chunk in [<paramref name="ku_li_BEGIN_"/>, <paramref name="u_li_end_"/>),
+	/// adding a job for the upper half of the range until only one chunk is left, which is run by the calling thread.
+	///</summary>
+	///<param name="chunks_">The callable and the latch counting down completed chunks.</param>
+	///<param name="ku_li_BEGIN_">The first chunk.</param>
+	///<param name="u_li_end_">One past the last chunk.</param>
+	///<remarks>
+	/// If the queue is full, the upper half is run by the calling thread instead of waiting for room,
+	/// so splitting never blocks a thread of the pool.
+	///</remarks>
+	template <class Chunk_Fn>
+	void split_chunks(Chunks_t<Chunk_Fn>& chunks_, const std::size_t ku_li_BEGIN_, std::size_t u_li_end_)
+	{
+		while (u_li_end_ - ku_li_BEGIN_ > 1)
+		{
+			const std::size_t ku_li_MID = ku_li_BEGIN_ + (u_li_end_ - ku_li_BEGIN_) / 2;
+			Job_t job(Chunk_Run_t<Chunk_Fn>(this, &chunks_, ku_li_MID, u_li_end_));
+
+			if (try_push_job(job, false) == false)
+			{
+				job();
+			} // end if
+
+			u_li_end_ = ku_li_MID;
+		} // end while
+
+		try
+		{
+			chunks_.m_fn_chunk(ku_li_BEGIN_);
+		} // end try
+		catch (...)
+		{
+			chunks_.m_latch.Fail(std::current_exception());
+		} // end catch all
+
+		chunks_.m_latch.Count_Down();
+	} // end method split_chunks
+
+
+	///<summary>
+	/// Blocks the calling thread until <paramref name="latch_"/> reaches 0, executing queued jobs while there are any.
+	///</summary>
+	///<param name="latch_">The latch to wait for.</param>
+	///<returns>The first exception recorded by the latch, or a nullptr.</returns>
+	///<remarks>
+	/// The calling thread only blocks once no job is queued, i.e. when all remaining jobs of the latch
+	/// are being executed by other threads, so it never waits for a job that nobody would run.
+	///</remarks>
+	std::exception_ptr wait_helping(Latch_t& latch_)
+	{
+		while (latch_.ma_u_li_count.load(std::memory_order_acquire) != 0 && try_run_one() == true)
+		{
+		} // end while
+
+		return latch_.Wait();
+	} // end method wait_helping
+
+
+	///<summary>
+	/// Removes and returns the next job from the queue and sets the calling thread's status. 
+	/// If no jobs are queued, the calling thread polls the queue up to the configured spin count
+	/// and then parks itself until a job is added or it is told to terminate, see <see cref="IDLE_STRATEGIES"/>.
+	///</summary>
+	///<returns>
+	/// A callable function object that the thread should execute, or an empty 
+	/// function object if the thread received a sigterm.
+	///</returns>
+	Job_t get_work(void)
+	{
+		Job_t job;
+		std::size_t u_li_spins = 0;
+		bool b_idle = false;
+
+		while (is_terminating() == false)
+		{
+			if (stands_by() == true)
+			{
+				if (b_idle == false)
+				{
+					set_idle();
+					b_idle = true;
+				} // end if
+
+				stand_by();
+				u_li_spins = 0;
+				continue;
+			} // end if
+
+			if (find_job(job) == true)
+			{
+				set_signal(THREAD_SIGNALS::TP_WORKING);
+				break;
+			} // end if
+
+			// the idle period only ends with a job, waking up from parking does not restart the idle timeout
+			if (b_idle == false)
+			{
+				set_idle();
+				b_idle = true;
+			} // end if
+
+			if (u_li_spins == 0)
+			{
+				// the last job may just have been completed, checking once per idle period is enough
+				wake_synchronizers();
+			} // end if
+
+			if (M_IDLE == IDLE_STRATEGIES::TP_IDLE_SPIN || (M_IDLE == IDLE_STRATEGIES::TP_IDLE_HYBRID && u_li_spins < mu_li_spin_count))
+			{
+				u_li_spins++;
+				std::this_thread::yield();
+			} // end if
+			else
+			{
+				park();
+				u_li_spins = 0;
+			} // end else
+		} // end while
+
+		return job;
+	} // end method get_work
+
+
+	///<summary>
+	/// Marks the calling thread as idle. The time the thread became idle is stored before the signal is published,
+	/// so adjust_threads never pairs the idle signal with the time of an earlier idle period.
+	///</summary>
+	void set_idle(void) noexcept
+	{
+		if (mu_li_max_threads != 0)
+		{
+			ts_p_worker->ma_li_idle_since.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+		} // end if
+
+		set_signal(THREAD_SIGNALS::TP_IDLE);
+	} // end method set_idle
+
+
+	///<summary>
+	/// Blocks the calling thread until a job is added to the queue or the thread receives a sigterm.
+	///</summary>
+	///<remarks>
+	/// The parked counter is published before the queue is re-checked, and producers publish
+	/// the queue counter before reading the parked counter, so a job added concurrently is
+	/// either seen here or the producer sees this thread as parked and wakes it up.
+	/// Spurious wake ups are harmless, get_work simply checks the queue again.
+	///</remarks>
+	void park(void)
+	{
+		Lock_t lock(m_mtx_park);
+
+		ma_u_li_nparked++;
+
+		if (has_queued_jobs() == false && is_terminating() == false)
+		{
+#ifdef THREAD_POOL_ENABLE_TRACING
+			const bool kb_TRACE = Tracing();
+
+			if (kb_TRACE == true)
+			{
+				trace(TRACE_EVENTS::TP_TRACE_PARK, trace_now(), 0, nullptr);
+			} // end if
+#endif
+
+			m_cv_park.wait(lock);
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+			if (kb_TRACE == true)
+			{
+				trace(TRACE_EVENTS::TP_TRACE_UNPARK, trace_now(), 0, nullptr);
+			} // end if
+#endif
+		} // end if
+
+		ma_u_li_nparked--;
+	} // end method park
+
+
+	///<summary>
+	/// Wakes up one parked thread, if any thread is parked.
+	///</summary>
+	void wake_one(void)
+	{
+		wake_some(1);
+	} // end method wake_one
+
+
+	///<summary>
+	/// Wakes up <paramref name="ku_li_COUNT_"/> parked threads, or all of them if fewer threads are parked.
+	///</summary>
+	///<param name="ku_li_COUNT_">The number of threads to wake up.</param>
+	void wake_some(const std::size_t ku_li_COUNT_)
+	{
+		const std::size_t ku_li_NPARKED = ma_u_li_nparked.load();
+
+		if (ku_li_NPARKED != 0 && ku_li_COUNT_ != 0)
+		{
+			// acquiring the lock guarantees that a thread which is about to park is already waiting
+			{
+				Guard_t guard(m_mtx_park);
+			} // end Guard_t
+
+			if (ku_li_COUNT_ >= ku_li_NPARKED)
+			{
+				m_cv_park.notify_all();
+			} // end if
+			else
+			{
+				for (std::size_t i = 0; i < ku_li_COUNT_; i++)
+				{
+					m_cv_park.notify_one();
+				} // end for i
+			} // end else
+		} // end if
+	} // end method wake_some
+
+
+	///<summary>
+	/// Wakes up all parked threads.
+	///</summary>
+	void wake_all(void)
+	{
+		{
+			Guard_t guard(m_mtx_park);
+		} // end Guard_t
+
+		m_cv_park.notify_all();
+		wake_standby();
+	} // end method wake_all
+
+
+	///<summary>
+	/// Wakes up all compensating threads standing by, so they check whether they are needed.
+	///</summary>
+	void wake_standby(void)
+	{
+		{
+			Guard_t guard(m_mtx_standby);
+		} // end Guard_t
+
+		m_cv_standby.notify_all();
+	} // end method wake_standby
+
+
+	///<summary>
+	/// Returns whether or not the calling thread is a compensating thread that is not needed.
+	///</summary>
+	///<remarks>
+	/// Compensating threads are counted rather than tracked, the threads with the highest ids stand by,
+	/// as many as compensating threads were started beyond the threads inside blocking regions.
+	///</remarks>
+	bool stands_by(void) const noexcept
+	{
+		const std::size_t ku_li_NCOMPENSATING = ma_u_li_ncompensating.load(std::memory_order_relaxed);
+
+		return ku_li_NCOMPENSATING != 0 && ts_p_worker->mu_li_id + ku_li_NCOMPENSATING >= 
+			ma_u_li_nrunning.load(std::memory_order_relaxed) + std::min(ma_u_li_nblocking.load(std::memory_order_relaxed), ku_li_NCOMPENSATING);
+	} // end method stands_by
+
+
+	///<summary>
+	/// Blocks the calling compensating thread, which is marked as idle, until it is needed again or receives a sigterm.
+	///</summary>
+	void stand_by(void)
+	{
+		wake_synchronizers();
+
+		// the thread may have been woken up for a job, or left jobs in its deque, a thread that keeps running takes them instead
+		if (has_queued_jobs() == true)
+		{
+			wake_one();
+		} // end if
+
+		Lock_t lock(m_mtx_standby);
+
+		m_cv_standby.wait(lock, [this](void) { return stands_by() == false || is_terminating() == true; });
+	} // end method stand_by
+
+
+	///<summary>
+	/// Counts the calling thread of this pool as blocked, unless it is inside a blocking region already, 
+	/// and lets a compensating thread take its place.
+	///</summary>
+	void enter_blocking(void)
+	{
+		if (ts_p_worker->mu_li_blocking_depth++ != 0)
+		{
+			return;
+		} // end if
+
+		// a compensating thread standing by takes the place of this thread
+		if (++ma_u_li_nblocking <= ma_u_li_ncompensating.load())
+		{
+			wake_standby();
+			return;
+		} // end if
+
+		if (ma_u_li_ncompensating.load() >= mu_li_max_compensating)
+		{
+			return;
+		} // end if
+
+		// threads are started by the manager thread, a thread resizing the pool may be waiting for this thread to terminate
+		{
+			Guard_t guard(m_mtx_manager);
+			mb_compensate = true;
+		} // end Guard_t
+
+		m_cv_manager.notify_all();
+	} // end method enter_blocking
+
+
+	///<summary>
+	/// Counts the calling thread of this pool as no longer blocked once it leaves its outermost blocking region,
+	/// a compensating thread stands by after its current job.
+	///</summary>
+	void exit_blocking(void) noexcept
+	{
+		if (--ts_p_worker->mu_li_blocking_depth == 0)
+		{
+			ma_u_li_nblocking--;
+		} // end if
+	} // end method exit_blocking
+
+
+	///<summary>
+	/// Starts compensating threads until there is one for every thread inside a blocking region, 
+	/// or <see cref="Settings::u_li_max_compensating"/> are running. Must be called while holding <see cref="m_mtx_resize"/>.
+	///</summary>
+	///<remarks>
+	/// A compensating thread is started before it is counted, so no running thread stands by while it starts.
+	///</remarks>
+	void compensate(void)
+	{
+		std::size_t u_li_ncompensating = ma_u_li_ncompensating.load();
+
+		while (ma_u_li_nrunning != 0 && ma_u_li_nblocking.load() > u_li_ncompensating && u_li_ncompensating < mu_li_max_compensating)
+		{
+			const std::size_t ku_li_NTHREADS = mu_li_nthreads;
+
+			start_threads(ma_u_li_nrunning + 1);
+			ma_u_li_ncompensating.store(++u_li_ncompensating);
+
+			// compensating threads are not started again by Start_All_Threads
+			mu_li_nthreads = ku_li_NTHREADS;
+		} // end while
+	} // end method compensate
+
+
+	///<summary>
+	/// Wakes up all threads blocked in Synchronize, if any, so they check whether all jobs have completed.
+	/// Must be called after the calling thread completed or discarded jobs.
+	///</summary>
+	///<remarks>
+	/// Synchronize publishes its counter before checking the pending jobs, and the counter is read here 
+	/// after the completion was published, so either side sees the other.
+	///</remarks>
+	void wake_synchronizers(void) const
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (ma_u_li_nsyncing.load() != 0)
+		{
+			{
+				Guard_t guard(m_mtx_sync);
+			} // end Guard_t
+
+			m_cv_sync.notify_all();
+		} // end if
+	} // end method wake_synchronizers
+
+
+	///<summary>
+	/// Adds the given job <paramref name="fn_job_"/> to the end of the queue of priority <paramref name="ke_PRIORITY_"/> 
+	/// without ever waiting for room, the path for jobs added by threads of the pool and the timer thread.
+	///</summary>
+	///<remarks>
+	/// A thread waiting for room in the queue may be the only one that would make room. Forced jobs exceed the capacity 
+	/// of the locked queue, and go to the overflow queue of the node if the rings are full, see <see cref="try_push_shared"/>.
+	///</remarks>
+	///<param name="fn_job_">The job to add.</param>
+	///<param name="ke_PRIORITY_">The priority of the job.</param>
+	///<param name="kb_SHARED_">Whether or not normal priority jobs of threads of the pool go to the shared queue too.</param>
+	void push_forced(Job_t& fn_job_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL, const bool kb_SHARED_ = false)
+	{
+		// a forced push into the shared queue cannot fail
+		try_push_job(fn_job_, true, ke_PRIORITY_, kb_SHARED_);
+	} // end method push_forced
+
+
+	///<summary>
+	/// Attempts to add the given job <paramref name="fn_job_"/> to the end of the queue of priority 
+	/// <paramref name="ke_PRIORITY_"/> and wakes up a parked thread.
+	/// In work stealing mode, normal priority jobs added by a thread of this pool are added to that thread's deque instead,
+	/// as are jobs of other priorities if the shared queue is full, so threads of the pool never wait for room.
+	///</summary>
+	///<param name="fn_job_">The job to add, it is only moved from if the call succeeds.</param>
+	///<param name="kb_FORCE_">Whether or not the locked queue may grow beyond its maximum size.</param>
+	///<param name="ke_PRIORITY_">The priority of the job.</param>
+	///<param name="kb_SHARED_">Whether or not normal priority jobs of threads of the pool go to the shared queue too, unless it is full.</param>
+	///<returns>True if the job was added, false if the queue was full.</returns>
+	bool try_push_job(Job_t& fn_job_, const bool kb_FORCE_, const JOB_PRIORITIES ke_PRIORITY_ = JOB_PRIORITIES::TP_PRIORITY_NORMAL, const bool kb_SHARED_ = false)
+	{
+		fn_job_.Stamp();
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+		// the job may be executed before it is recorded as added, so the time is taken before it is visible
+		const bool kb_TRACE = Tracing();
+		const std::uint64_t ku_li_TRACE_NS = kb_TRACE == true ? trace_now() : 0;
+
+		if (kb_TRACE == true)
+		{
+			assign_trace_id(fn_job_);
+		} // end if
+
+		const std::uint64_t ku_li_TRACE_ID = fn_job_.Trace_Id();
+		const char* const kp_LABEL = fn_job_.Label();
+#endif
+
+		// jobs have to be counted as submitted before they can be executed, see n_jobs_pending
+		count_submissions(1);
+
+		if ((kb_SHARED_ == false && submits_locally(ke_PRIORITY_) == true) || try_push_shared(fn_job_, kb_FORCE_, ke_PRIORITY_) == false)
+		{
+			if (submits_locally(JOB_PRIORITIES::TP_PRIORITY_NORMAL) == false)
+			{
+				count_submissions(-1);
+				return false;
+			} // end if
+
+			ts_p_worker->m_deque_jobs.Push(new_job(std::move(fn_job_)));
+
+			if constexpr (M_METRICS == true)
+			{
+				Metrics_t::Raise(ts_p_worker->m_metrics.ma_u_li_deque_high_water, ts_p_worker->m_deque_jobs.Size());
+			} // end if
+		} // end if
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+		if (kb_TRACE == true)
+		{
+			trace(TRACE_EVENTS::TP_TRACE_ENQUEUE, ku_li_TRACE_NS, ku_li_TRACE_ID, kp_LABEL, static_cast<std::uint32_t>(ke_PRIORITY_));
+		} // end if
+#endif
+
+		// the job has to be visible before the parked counter is read, see park
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		wake_one();
+
+		return true;
+	} // end method try_push_job
+
+
+	///<summary>
+	/// Attempts to add the given job <paramref name="fn_job_"/> to the end of the shared queue of priority 
+	/// <paramref name="ke_PRIORITY_"/>, without counting it as submitted or waking up a thread.
+	/// With node queues, the queue of the calling thread's node is tried first, then the queues of the other nodes.
+	///</summary>
+	///<param name="fn_job_">The job to add, it is only moved from if the call succeeds.</param>
+	///<param name="kb_FORCE_">
+	/// Whether or not the locked queue may grow beyond its maximum size, and jobs that do not fit the full rings 
+	/// go to the locked queue of the calling thread's node, which is their overflow queue.
+	///</param>
+	///<param name="ke_PRIORITY_">The priority of the job.</param>
+	///<returns>True if the job was added, false if the queue was full, never false if <paramref name="kb_FORCE_"/> is true.</returns>
+	bool try_push_shared(Job_t& fn_job_, const bool kb_FORCE_, const JOB_PRIORITIES ke_PRIORITY_)
+	{
+		const std::size_t ku_li_HOME = home_node();
+
+		for (std::size_t i = 0; i < m_vect_nodes.size(); i++)
+		{
+			Node_Queue_t& node = *m_vect_nodes[(ku_li_HOME + i) % m_vect_nodes.size()];
+
+			if (uses_ring() == true)
+			{
+				if (node.m_arr_p_ring_tasks[ke_PRIORITY_]->Try_Push(fn_job_) == true)
+				{
+					if constexpr (M_METRICS == true)
+					{
+						Metrics_t::Raise(node.ma_u_li_high_water, node.m_arr_p_ring_tasks[ke_PRIORITY_]->Size());
+					} // end if
+
+					return true;
+				} // end if
+
+				continue;
+			} // end if
+
+			Guard_t guard(node.m_mtx_tasks);
+
+			if (kb_FORCE_ == true || n_locked_queued(node) < mu_li_capacity)
+			{
+				node.m_arr_q_tasks[ke_PRIORITY_].push(std::move(fn_job_));
+				node.ma_arr_u_li_nqueued[ke_PRIORITY_]++;
+
+				if constexpr (M_METRICS == true)
+				{
+					Metrics_t::Raise(node.ma_u_li_high_water, n_locked_queued(node));
+				} // end if
+
+				return true;
+			} // end if
+		} // end for i
+
+		if (kb_FORCE_ == true)
+		{
+			Node_Queue_t& node = *m_vect_nodes[ku_li_HOME];
+			Guard_t guard(node.m_mtx_tasks);
+
+			node.m_arr_q_tasks[ke_PRIORITY_].push(std::move(fn_job_));
+			node.ma_arr_u_li_nqueued[ke_PRIORITY_]++;
+
+			if constexpr (M_METRICS == true)
+			{
+				Metrics_t::Raise(node.ma_u_li_high_water, node.m_arr_p_ring_tasks[ke_PRIORITY_]->Size() + n_locked_queued(node));
+			} // end if
+
+			return true;
+		} // end if
+
+		return false;
+	} // end method try_push_shared
+
+
+	///<summary>
+	/// Attempts to add the jobs in the range [<paramref name="first_"/>, <paramref name="last_"/>) to the end 
+	/// of the queue of priority <paramref name="ke_PRIORITY_"/> and wakes up as many parked threads as jobs were added.
+	/// In work stealing mode, jobs added by a thread of this pool are added to that thread's deque like in <see cref="try_push_job"/>.
+	///</summary>
+	///<param name="first_">Iterator to the first job to add, it is advanced past the last job that was added.</param>
+	///<param name="last_">Iterator one past the last job to add.</param>
+	///<param name="ke_PRIORITY_">The priority of the jobs.</param>
+	///<returns>True if all jobs were added, false if the queue was full before the last job was added.</returns>
+	template <class ForwardIt>
+	bool try_push_jobs(ForwardIt& first_, const ForwardIt& last_, const JOB_PRIORITIES ke_PRIORITY_)
+	{
+		const std::size_t ku_li_COUNT = static_cast<std::size_t>(std::distance(first_, last_));
+		std::size_t u_li_npushed = 0;
+
+		if (ku_li_COUNT == 0)
+		{
+			return true;
+		} // end if
+
+		// other value types are converted to jobs when they are added, which stamps them
+		if constexpr (M_METRICS == true && std::is_same<typename std::iterator_traits<ForwardIt>::value_type, Job_t>::value)
+		{
+			for (ForwardIt it = first_; it != last_; ++it)
+			{
+				it->Stamp();
+			} // end for it
+		} // end if
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+		// the jobs are recorded as added before any of them is visible, jobs that don't fit are recorded again when retried
+		if constexpr (std::is_same<typename std::iterator_traits<ForwardIt>::value_type, Job_t>::value)
+		{
+			if (Tracing() == true)
+			{
+				const std::uint64_t ku_li_TRACE_NS = trace_now();
+
+				for (ForwardIt it = first_; it != last_; ++it)
+				{
+					assign_trace_id(*it);
+					trace(TRACE_EVENTS::TP_TRACE_ENQUEUE, ku_li_TRACE_NS, it->Trace_Id(), it->Label(), static_cast<std::uint32_t>(ke_PRIORITY_));
+				} // end for it
+			} // end if
+		} // end if
+#endif
+
+		// jobs have to be counted as submitted before they can be executed, see n_jobs_pending
+		count_submissions(static_cast<std::ptrdiff_t>(ku_li_COUNT));
+
+		const std::size_t ku_li_HOME = home_node();
+
+		// like try_push_shared, the queues of other nodes take what does not fit into the queue of the home node
+		for (std::size_t i = 0; i < m_vect_nodes.size() && u_li_npushed < ku_li_COUNT && submits_locally(ke_PRIORITY_) == false; i++)
+		{
+			Node_Queue_t& node = *m_vect_nodes[(ku_li_HOME + i) % m_vect_nodes.size()];
+
+			if (uses_ring() == true)
+			{
+				u_li_npushed += node.m_arr_p_ring_tasks[ke_PRIORITY_]->Try_Push_Bulk(first_, ku_li_COUNT - u_li_npushed);
+
+				if constexpr (M_METRICS == true)
+				{
+					Metrics_t::Raise(node.ma_u_li_high_water, node.m_arr_p_ring_tasks[ke_PRIORITY_]->Size());
+				} // end if
+				continue;
+			} // end if
+
+			Guard_t guard(node.m_mtx_tasks);
+			const std::size_t ku_li_NQUEUED = n_locked_queued(node);
+			std::size_t u_li_nfit = 0;
+
+			if (ku_li_NQUEUED < mu_li_capacity)
+			{
+				u_li_nfit = std::min(ku_li_COUNT - u_li_npushed, mu_li_capacity - ku_li_NQUEUED);
+			} // end if
+
+			for (std::size_t j = 0; j < u_li_nfit; j++, ++first_)
+			{
+				node.m_arr_q_tasks[ke_PRIORITY_].push(std::move(*first_));
+			} // end for j
+
+			node.ma_arr_u_li_nqueued[ke_PRIORITY_] += u_li_nfit;
+			u_li_npushed += u_li_nfit;
+
+			if constexpr (M_METRICS == true)
+			{
+				Metrics_t::Raise(node.ma_u_li_high_water, ku_li_NQUEUED + u_li_nfit);
+			} // end if
+		} // end for i
+
+		// threads of the pool add what did not fit into the shared queue to their own deque
+		if (submits_locally(JOB_PRIORITIES::TP_PRIORITY_NORMAL) == true)
+		{
+			for (; first_ != last_; ++first_, u_li_npushed++)
+			{
+				ts_p_worker->m_deque_jobs.Push(new_job(std::move(*first_)));
+			} // end for first_
+
+			if constexpr (M_METRICS == true)
+			{
+				Metrics_t::Raise(ts_p_worker->m_metrics.ma_u_li_deque_high_water, ts_p_worker->m_deque_jobs.Size());
+			} // end if
+		} // end if
+
+		if (u_li_npushed != ku_li_COUNT)
+		{
+			count_submissions(-static_cast<std::ptrdiff_t>(ku_li_COUNT - u_li_npushed));
+		} // end if
+
+		// the jobs have to be visible before the parked counter is read, see park
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		wake_some(u_li_npushed);
+
+		return u_li_npushed == ku_li_COUNT;
+	} // end method try_push_jobs
+
+
+	///<summary>
+	/// Invokes <paramref name="fn_try_push_"/> to add jobs to the end of the queue, parking the calling thread
+	/// while the queue is full until a job is removed or <paramref name="kp_DEADLINE_"/> passes.
+	/// Threads of the pool execute queued jobs meanwhile instead of parking.
+	///</summary>
+	///<param name="fn_try_push_">
+	/// Callable attempting to add the jobs without blocking, returns true once all jobs were added.
+	/// It is invoked again after every job removed from the queue.
+	///</param>
+	///<param name="kp_DEADLINE_">The point in time to give up at, or nullptr to wait indefinitely.</param>
+	///<returns>True if the jobs were added, false if the deadline passed first.</returns>
+	///<remarks>
+	/// Like parked threads of the pool in <see cref="park"/>, blocked producers are counted before
+	/// they retry and consumers check the counter after they freed a slot, see <see cref="wake_producer"/>.
+	///</remarks>
+	template <class Try_Push_t, class Clock = std::chrono::steady_clock, class Duration = typename Clock::duration>
+	bool push_waiting(Try_Push_t&& fn_try_push_, const std::chrono::time_point<Clock, Duration>* kp_DEADLINE_ = nullptr)
+	{
+		if (fn_try_push_() == true)
+		{
+			return true;
+		} // end if
+
+		// the jobs of the pool may all be waiting for room, with nobody left to make it
+		if (ts_p_pool == this)
+		{
+			while (fn_try_push_() == false)
+			{
+				if (kp_DEADLINE_ != nullptr && Clock::now() >= *kp_DEADLINE_)
+				{
+					return false;
+				} // end if
+
+				if (try_run_one() == false)
+				{
+					std::this_thread::yield();
+				} // end if
+			} // end while
+
+			return true;
+		} // end if
+
+		Lock_t lock(m_mtx_space);
+		bool b_out = false;
+
+		while (b_out == false)
+		{
+			ma_u_li_nblocked++;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			b_out = fn_try_push_();
+
+			if (b_out == false)
+			{
+				if (kp_DEADLINE_ == nullptr)
+				{
+					m_cv_space.wait(lock);
+				} // end if
+				else if (m_cv_space.wait_until(lock, *kp_DEADLINE_) == std::cv_status::timeout)
+				{
+					ma_u_li_nblocked--;
+
+					// the notification may have been meant for this thread, so try one last time
+					return fn_try_push_();
+				} // end elif
+			} // end if
+
+			ma_u_li_nblocked--;
+		} // end while
+
+		return b_out;
+	} // end method push_waiting
+
+
+	///<summary>
+	/// Wakes up one producer blocked on a full queue, if any producer is blocked.
+	/// Must be called after a job was removed from the shared queue.
+	///</summary>
+	void wake_producer(void)
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (ma_u_li_nblocked.load() != 0)
+		{
+			{
+				Guard_t guard(m_mtx_space);
+			} // end Guard_t
+
+			m_cv_space.notify_one();
+		} // end if
+	} // end method wake_producer
+
+
+	///<summary>
+	/// Attempts to remove the next job from the queue without blocking, taking jobs of higher priority first.
+	///</summary>
+	///<param name="fn_job_">Receives the job if one was available.</param>
+	///<param name="ku_li_NPRIORITIES_">The number of priorities to check, 1 to only check the priority that would be checked first.</param>
+	///<returns>True if a job was removed from the queue, false otherwise.</returns>
+	///<remarks>
+	/// To keep a steady stream of higher priority jobs from starving lower priorities, every 
+	/// <see cref="Settings::u_li_starvation_limit"/>-th job a thread of this pool takes is looked for 
+	/// at a lower priority first, alternating between the lower priorities.
+	///</remarks>
+	bool try_pop_job(Job_t& fn_job_, const std::size_t ku_li_NPRIORITIES_ = JOB_PRIORITIES::TP_N_PRIORITIES)
+	{
+		std::size_t u_li_first = JOB_PRIORITIES::TP_PRIORITY_HIGH;
+
+		if (ts_p_pool == this && mu_li_starvation_limit != 0)
+		{
+			const std::size_t ku_li_NPOPS = ts_p_worker->mu_li_npops;
+
+			if (ku_li_NPOPS % mu_li_starvation_limit == mu_li_starvation_limit - 1)
+			{
+				u_li_first = 1 + (ku_li_NPOPS / mu_li_starvation_limit) % (JOB_PRIORITIES::TP_N_PRIORITIES - 1);
+			} // end if
+		} // end if
+
+		for (std::size_t i = 0; i < ku_li_NPRIORITIES_; i++)
+		{
+			if (try_pop_level(fn_job_, static_cast<JOB_PRIORITIES>((u_li_first + i) % JOB_PRIORITIES::TP_N_PRIORITIES)) == true)
+			{
+				if (ts_p_pool == this)
+				{
+					ts_p_worker->mu_li_npops++;
+				} // end if
+
+				return true;
+			} // end if
+		} // end for i
+
+		return false;
+	} // end method try_pop_job
+
+
+	///<summary>
+	/// Attempts to remove the next job from the queue of priority <paramref name="ke_PRIORITY_"/> without blocking.
+	/// With node queues, the queue of the calling thread's node is tried first, then the queues of the other nodes.
+	///</summary>
+	///<param name="fn_job_">Receives the job if one was available.</param>
+	///<param name="ke_PRIORITY_">The priority of the queue.</param>
+	///<returns>True if a job was removed from the queue, false otherwise.</returns>
+	bool try_pop_level(Job_t& fn_job_, const JOB_PRIORITIES ke_PRIORITY_)
+	{
+		const std::size_t ku_li_HOME = home_node();
+
+		for (std::size_t i = 0; i < m_vect_nodes.size(); i++)
+		{
+			if (try_pop_node(*m_vect_nodes[(ku_li_HOME + i) % m_vect_nodes.size()], fn_job_, ke_PRIORITY_) == true)
+			{
+				wake_producer();
+
+				return true;
+			} // end if
+		} // end for i
+
+		return false;
+	} // end method try_pop_level
+
+
+	///<summary>
+	/// Attempts to remove the next job from the queue of priority <paramref name="ke_PRIORITY_"/> of 
+	/// the node queue <paramref name="node_"/> without blocking or waking up a producer.
+	///</summary>
+	///<param name="node_">The node queue to take the job from.</param>
+	///<param name="fn_job_">Receives the job if one was available.</param>
+	///<param name="ke_PRIORITY_">The priority of the queue.</param>
+	///<returns>True if a job was removed from the queue, false otherwise.</returns>
+	///<remarks>
+	/// With ring buffers, the overflow of forced jobs in the locked queue is taken first, 
+	/// so it cannot be starved by producers keeping the ring full.
+	///</remarks>
+	bool try_pop_node(Node_Queue_t& node_, Job_t& fn_job_, const JOB_PRIORITIES ke_PRIORITY_)
+	{
+		// avoid contending for the mutex while the queue is empty
+		if (node_.ma_arr_u_li_nqueued[ke_PRIORITY_].load(std::memory_order_relaxed) != 0)
+		{
+			Guard_t guard(node_.m_mtx_tasks);
+			Job_Queue_t& q_tasks = node_.m_arr_q_tasks[ke_PRIORITY_];
+
+			if (q_tasks.empty() == false)
+			{
+				fn_job_ = std::move(q_tasks.front());
+				q_tasks.pop();
+				node_.ma_arr_u_li_nqueued[ke_PRIORITY_]--;
+
+				return true;
+			} // end if
+		} // end if
+
+		return uses_ring() == true && node_.m_arr_p_ring_tasks[ke_PRIORITY_]->Try_Pop(fn_job_) == true;
+	} // end method try_pop_node
+
+
+	///<summary>
+	/// Returns the number of jobs in the shared queue at the time of invocation.
+	///</summary>
+	///<returns>The number of jobs in the shared queue, summed over all priorities and including the overflow of the rings.</returns>
+	std::size_t n_queued(void) const noexcept
+	{
+		std::size_t u_li_out = 0;
+
+		for (const auto& p_node : m_vect_nodes)
+		{
+			for (std::size_t i = 0; i < JOB_PRIORITIES::TP_N_PRIORITIES; i++)
+			{
+				if (uses_ring() == true)
+				{
+					u_li_out += p_node->m_arr_p_ring_tasks[i]->Size();
+				} // end if
+
+				u_li_out += p_node->ma_arr_u_li_nqueued[i].load();
+			} // end for i
+		} // end for p_node
+
+		return u_li_out;
+	} // end method n_queued
+
+
+	///<summary>
+	/// Returns the number of jobs in the locked queue of the node queue <paramref name="k_node_"/>.
+	/// Must be called while holding the mutex of the node queue.
+	///</summary>
+	///<returns>The number of jobs in the locked queue, summed over all priorities.</returns>
+	static std::size_t n_locked_queued(const Node_Queue_t& k_node_) noexcept
+	{
+		std::size_t u_li_out = 0;
+
+		for (const auto& q_tasks : k_node_.m_arr_q_tasks)
+		{
+			u_li_out += q_tasks.size();
+		} // end for q_tasks
+
+		return u_li_out;
+	} // end method n_locked_queued
+
+
+	///<summary>
+	/// Returns the index of the node queue the calling thread submits to and takes jobs from first.
+	///</summary>
+	///<returns>
+	/// The node of the calling thread for threads of this pool, otherwise the next node in round robin order.
+	///</returns>
+	std::size_t home_node(void) noexcept
+	{
+		if (m_vect_nodes.size() == 1)
+		{
+			return 0;
+		} // end if
+
+		if (ts_p_pool == this)
+		{
+			return ts_p_worker->mu_li_node;
+		} // end if
+
+		return ma_u_li_next_node.fetch_add(1, std::memory_order_relaxed) % m_vect_nodes.size();
+	} // end method home_node
+
+
+	///<summary>
+	/// Counts jobs as submitted by the calling thread, or retracts such counts if the jobs could not be added.
+	///</summary>
+	///<param name="k_li_DELTA_">The number of submissions to count, negative to retract submissions.</param>
+	void count_submissions(const std::ptrdiff_t k_li_DELTA_) noexcept
+	{
+		// unsigned arithmetic wraps, so adding the converted delta also retracts
+		const std::size_t ku_li_DELTA = static_cast<std::size_t>(k_li_DELTA_);
+
+		if (ts_p_pool == this)
+		{
+			std::atomic<std::size_t>& a_u_li_nsubmitted = ts_p_worker->ma_u_li_nsubmitted;
+
+			a_u_li_nsubmitted.store(a_u_li_nsubmitted.load(std::memory_order_relaxed) + ku_li_DELTA, std::memory_order_release);
+		} // end if
+		else
+		{
+			ma_u_li_nsubmitted += ku_li_DELTA;
+		} // end else
+	} // end method count_submissions
+
+
+	///<summary>
+	/// Attempts to find a job for the calling thread of this pool without blocking. In work stealing mode, 
+	/// high priority jobs in the shared queue are checked first, then the thread's own deque, 
+	/// then the rest of the shared queue, and finally the deques of other threads.
+	///</summary>
+	///<param name="fn_job_">Receives the job if one was found.</param>
+	///<returns>True if a job was found, false otherwise.</returns>
+	bool find_job(Job_t& fn_job_)
+	{
+		Job_t* p_job = nullptr;
+
+		// only the first priority, high unless lower priorities are due, see try_pop_job
+		if (me_scheduling == SCHEDULING_MODES::TP_WORK_STEALING && try_pop_job(fn_job_, 1) == true)
+		{
+			return true;
+		} // end if
+
+		if (me_scheduling == SCHEDULING_MODES::TP_WORK_STEALING && ts_p_worker->m_deque_jobs.Pop(p_job) == true)
+		{
+			fn_job_ = std::move(*p_job);
+			delete_job(p_job);
+
+			return true;
+		} // end if
+
+		if (try_pop_job(fn_job_) == true)
+		{
+			return true;
+		} // end if
+
+		return me_scheduling == SCHEDULING_MODES::TP_WORK_STEALING && try_steal_job(fn_job_);
+	} // end method find_job
+
+
+	///<summary>
+	/// Attempts to steal a job from the deque of another thread, starting at a random victim.
+	/// If threads are pinned, victims on the same NUMA node are tried before victims on other nodes.
+	///</summary>
+	///<param name="fn_job_">Receives the stolen job.</param>
+	///<returns>True if a job was stolen, false otherwise.</returns>
+	bool try_steal_job(Job_t& fn_job_)
+	{
+		const Worker_Table_t& k_workers = *ma_p_workers.load(std::memory_order_acquire);
+		const std::size_t ku_li_NWORKERS = k_workers.size();
+
+		// xorshift, only used to spread stealers across victims
+		std::uint32_t& u_rng = ts_p_worker->mu_rng;
+		u_rng ^= u_rng << 13;
+		u_rng ^= u_rng >> 17;
+		u_rng ^= u_rng << 5;
+
+		// the data of jobs of a nearby victim is more likely to be in a shared cache and local memory
+		const std::size_t ku_li_NPASSES = m_vect_placement.empty() == true ? 1 : 2;
+
+		for (std::size_t u_li_pass = 0; u_li_pass < ku_li_NPASSES; u_li_pass++)
+		{
+			for (std::size_t i = 0; i < ku_li_NWORKERS; i++)
+			{
+				Worker_t* p_victim = k_workers[(u_rng + i) % ku_li_NWORKERS];
+				const bool kb_SAME_NODE = p_victim->mu_li_node == ts_p_worker->mu_li_node;
+				Job_t* p_job = nullptr;
+
+				if (p_victim == ts_p_worker || (ku_li_NPASSES > 1 && kb_SAME_NODE != (u_li_pass == 0)))
+				{
+					continue;
+				} // end if
+
+				if (p_victim->m_deque_jobs.Steal(p_job) == true)
+				{
+					fn_job_ = std::move(*p_job);
+					delete_job(p_job);
+
+					if constexpr (M_METRICS == true)
+					{
+						ts_p_worker->m_metrics.Add(ts_p_worker->m_metrics.ma_u_li_nstolen, 1);
+					} // end if
+#ifdef THREAD_POOL_ENABLE_TRACING
+					if (Tracing() == true)
+					{
+						trace(TRACE_EVENTS::TP_TRACE_STEAL, trace_now(), fn_job_.Trace_Id(), fn_job_.Label(), static_cast<std::uint32_t>(p_victim->mu_li_id));
+					} // end if
+#endif
+
+					// let another thread help with the remaining jobs of the victim
+					if (p_victim->m_deque_jobs.Empty() == false)
+					{
+						wake_one();
+					} // end if
+
+					return true;
+				} // end if
+			} // end for i
+		} // end for u_li_pass
+
+		return false;
+	} // end method try_steal_job
+
+
+	///<summary>
+	/// Attempts to steal a job from the deque of any thread of the pool for a thread outside the pool.
+	///</summary>
+	///<param name="fn_job_">Receives the stolen job.</param>
+	///<returns>True if a job was stolen, false otherwise.</returns>
+	///<remarks>Threads start at different victims, so several helping threads don't all contend for the first deque.</remarks>
+	bool try_steal_external(Job_t& fn_job_)
+	{
+		const Worker_Table_t& k_workers = *ma_p_workers.load(std::memory_order_acquire);
+		const std::size_t ku_li_NWORKERS = k_workers.size();
+		const std::size_t ku_li_FIRST = std::hash<std::thread::id>()(std::this_thread::get_id());
+
+		for (std::size_t i = 0; i < ku_li_NWORKERS; i++)
+		{
+			Worker_t* p_victim = k_workers[(ku_li_FIRST + i) % ku_li_NWORKERS];
+			Job_t* p_job = nullptr;
+
+			if (p_victim->m_deque_jobs.Steal(p_job) == true)
+			{
+				fn_job_ = std::move(*p_job);
+				delete_job(p_job);
+
+#ifdef THREAD_POOL_ENABLE_TRACING
+				if (Tracing() == true)
+				{
+					trace(TRACE_EVENTS::TP_TRACE_STEAL, trace_now(), fn_job_.Trace_Id(), fn_job_.Label(), static_cast<std::uint32_t>(p_victim->mu_li_id));
+				} // end if
+#endif
+
+				return true;
+			} // end if
+		} // end for i
+
+		return false;
+	} // end method try_steal_external
+
+
+	///<summary>
+	/// Returns whether or not any jobs are waiting in the queue or in the deque of any thread.
+	///</summary>
+	///<returns>True iff there are jobs waiting for execution.</returns>
+	bool has_queued_jobs(void) const
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (n_queued() != 0)
+		{
+			return true;
+		} // end if
+
+		if (me_scheduling == SCHEDULING_MODES::TP_WORK_STEALING)
+		{
+			for (auto p_worker : *ma_p_workers.load(std::memory_order_acquire))
+			{
+				if (p_worker->m_deque_jobs.Empty() == false)
+				{
+					return true;
+				} // end if
+			} // end for p_worker
+		} // end if
+
+		return false;
+	} // end method has_queued_jobs
+
+
+	///<summary>
+	/// Returns whether or not the calling thread adds jobs to its own deque rather than the shared queue.
+	///</summary>
+	///<param name="ke_PRIORITY_">The priority of the job.</param>
+	///<returns>True iff the pool is in work stealing mode, the calling thread belongs to this pool, and the priority is normal.</returns>
+	bool submits_locally(const JOB_PRIORITIES ke_PRIORITY_) const noexcept
+	{
+		return me_scheduling == SCHEDULING_MODES::TP_WORK_STEALING && ts_p_pool == this && ke_PRIORITY_ == JOB_PRIORITIES::TP_PRIORITY_NORMAL;
+	} // end method submits_locally
+
+
+	///<summary>
+	/// Returns whether or not the shared queues are ring buffers, a constant if the configuration selects the backend.
+	///</summary>
+	bool uses_ring(void) const noexcept
+	{
+		return M_QUEUE == QUEUE_BACKENDS::TP_QUEUE_ANY ? me_queue == QUEUE_BACKENDS::TP_QUEUE_RING : M_QUEUE == QUEUE_BACKENDS::TP_QUEUE_RING;
+	} // end method uses_ring
+
+
+	///<summary>
+	/// Allocates <paramref name="ku_li_BYTES_"/> bytes from the arena of the calling thread, 
+	/// threads outside the pool share one arena.
+	///</summary>
+	///<param name="ku_li_BYTES_">The size of the block.</param>
+	///<returns>The block, to be freed with Slab_Arena::Free by any thread.</returns>
+	void* allocate(const std::size_t ku_li_BYTES_)
+	{
+		if (ts_p_pool == this)
+		{
+			return ts_p_worker->m_arena.Allocate(ku_li_BYTES_);
+		} // end if
+
+		Guard_t guard(m_mtx_arena);
+
+		return m_arena_external.Allocate(ku_li_BYTES_);
+	} // end method allocate
+
+
+	///<summary>
+	/// Moves <paramref name="fn_job_"/> into a job record allocated from the arena of the calling thread, which must belong to the pool.
+	///</summary>
+	Job_t* new_job(Job_t&& fn_job_)
+	{
+		return ::new (ts_p_worker->m_arena.Allocate(sizeof(Job_t))) Job_t(std::move(fn_job_));
+	} // end method new_job
+
+
+	///<summary>
+	/// Destroys a job record created by <see cref="new_job"/>, on any thread.
+	///</summary>
+	static void delete_job(Job_t* p_job_)
+	{
+		p_job_->~Job_t();
+		Slab_Arena::Free(p_job_, sizeof(Job_t));
+	} // end method delete_job
+
+
+	///<summary>
+	/// Returns the number of jobs that were submitted but have neither completed nor been discarded.
+	///</summary>
+	///<returns>The number of pending jobs.</returns>
+	///<remarks>
+	/// All counters only ever grow and a job is always counted as submitted before it is counted as
+	/// completed. Reading every completion counter before any submission counter therefore never 
+	/// reports 0 while a job that was submitted before the call is still pending.
+	///</remarks>
+	std::size_t n_jobs_pending(void) const noexcept
+	{
+		const Worker_Table_t& k_workers = *ma_p_workers.load(std::memory_order_acquire);
+		std::size_t u_li_ndone = ma_u_li_ndiscarded.load() + ma_u_li_ncompleted.load();
+		std::size_t u_li_nsubmitted = 0;
+
+		for (auto p_worker : k_workers)
+		{
+			u_li_ndone += p_worker->ma_u_li_ncompleted.load(std::memory_order_acquire);
+		} // end for p_worker
+
+		u_li_nsubmitted = ma_u_li_nsubmitted.load();
+
+		for (auto p_worker : k_workers)
+		{
+			u_li_nsubmitted += p_worker->ma_u_li_nsubmitted.load(std::memory_order_acquire);
+		} // end for p_worker
+
+		return u_li_nsubmitted - u_li_ndone;
+	} // end method n_jobs_pending
+
+
+	///<summary>
+	/// Creates missing worker states for all threads and publishes the new worker table.
+	/// Must be called while holding <see cref="m_mtx_threads"/>.
+	///</summary>
+	///<remarks>
+	/// Other threads may be iterating over the current table, so tables are never modified 
+	/// after they are published and are kept alive until the pool is destroyed.
+	/// Worker states are reused when threads are restarted after Kill_All.
+	/// If threads are pinned, every worker is assigned its CPU and node here.
+	///</remarks>
+	void publish_workers(void)
+	{
+		if (m_vect_workers.size() >= mu_li_nthreads)
+		{
+			return;
+		} // end if
+
+		while (m_vect_workers.size() < mu_li_nthreads)
+		{
+			const std::size_t ku_li_ID = m_vect_workers.size();
+
+			m_vect_workers.emplace_back(new Worker_t(ku_li_ID, mp_memory_resource));
+
+			if (m_vect_placement.empty() == false)
+			{
+				const CPU_Topology::CPU_Info& k_cpu = m_vect_placement[ku_li_ID % m_vect_placement.size()];
+
+				m_vect_workers.back()->mu_li_cpu = k_cpu.u_li_cpu;
+				m_vect_workers.back()->mu_li_node = k_cpu.u_li_node;
+			} // end if
+		} // end while
+
+		m_vect_tables.emplace_back(new Worker_Table_t());
+
+		for (auto& p_worker : m_vect_workers)
+		{
+			m_vect_tables.back()->push_back(p_worker.get());
+		} // end for p_worker
+
+		ma_p_workers.store(m_vect_tables.back().get(), std::memory_order_release);
+	} // end method publish_workers
+
+
+	///<summary>
+	/// Blocks until all submitted jobs have completed, including jobs added by jobs, or until the deadline <paramref name="kp_DEADLINE_"/>.
+	///</summary>
+	///<param name="kp_DEADLINE_">The time after which to stop waiting, nullptr to wait without a deadline.</param>
+	///<returns>True if all jobs have completed, false if the deadline passed first.</returns>
+	bool wait_pending(const std::chrono::steady_clock::time_point* kp_DEADLINE_) const
+	{
+		Lock_t lock(m_mtx_sync);
+		bool b_out = true;
+
+		ma_u_li_nsyncing++;
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (kp_DEADLINE_ == nullptr)
+		{
+			m_cv_sync.wait(lock, [this](void) { return n_jobs_pending() == 0; });
+		} // end if
+		else
+		{
+			b_out = m_cv_sync.wait_until(lock, *kp_DEADLINE_, [this](void) { return n_jobs_pending() == 0; });
+		} // end else
+
+		ma_u_li_nsyncing--;
+
+		return b_out;
+	} // end method wait_pending
+
+
+	///<summary>
+	/// Terminates all threads, executing or discarding the pending jobs as given by <paramref name="ke_POLICY_"/>.
+	///</summary>
+	///<param name="ke_POLICY_">What to do with pending jobs.</param>
+	///<param name="k_deadline_">The time after which pending jobs are discarded with TP_SHUTDOWN_DEADLINE.</param>
+	///<returns>True if no pending job was discarded.</returns>
+	bool shutdown(const SHUTDOWN_POLICIES ke_POLICY_, const std::chrono::steady_clock::time_point& k_deadline_)
+	{
+		const std::size_t ku_li_NDISCARDED = ma_u_li_ndiscarded.load();
+
+		// scheduled jobs are not pending, and must not keep adding jobs while the pending ones are drained
+		stop_timers();
+
+		if (ke_POLICY_ != SHUTDOWN_POLICIES::TP_SHUTDOWN_CANCEL)
+		{
+			const std::chrono::steady_clock::time_point* kp_DEADLINE = ke_POLICY_ == SHUTDOWN_POLICIES::TP_SHUTDOWN_DEADLINE ? &k_deadline_ : nullptr;
+
+			// without threads, nobody else would execute the pending jobs
+			while (ma_u_li_nrunning == 0 && (kp_DEADLINE == nullptr || std::chrono::steady_clock::now() < *kp_DEADLINE) && try_run_one() == true)
+			{
+			} // end while
+
+			if (ma_u_li_nrunning != 0)
+			{
+				wait_pending(kp_DEADLINE);
+			} // end if
+		} // end if
+
+		stop_manager();
+
+		Guard_t guard(m_mtx_resize);
+
+		// threads must not start another job while the queue is emptied
+		signal_all(THREAD_SIGNALS::TP_SIGTERM);
+		wake_all();
+		Empty_Job_Queue();
+		stop_threads(0);
+
+		// the last jobs to complete may have added or scheduled jobs
+		stop_timers();
+		Empty_Job_Queue();
+
+		return ma_u_li_ndiscarded.load() == ku_li_NDISCARDED;
+	} // end method shutdown
+
+
+	///<summary>
+	/// Starts threads until <paramref name="ku_li_N_THREADS_"/> threads are running, growing the pool if needed.
+	/// Must be called while holding <see cref="m_mtx_resize"/>.
+	///</summary>
+	///<param name="ku_li_N_THREADS_">The number of threads that should be running.</param>
+	void start_threads(const std::size_t ku_li_N_THREADS_)
+	{
+		Guard_t guard(m_mtx_threads);
+
+		mu_li_nthreads = std::max(mu_li_nthreads, ku_li_N_THREADS_);
+		publish_workers();
+		m_vect_threads.reserve(mu_li_nthreads);
+
+		for (std::size_t i = ma_u_li_nrunning; i < ku_li_N_THREADS_; i++)
+		{
+			m_vect_workers[i]->ma_e_signal.store(THREAD_SIGNALS::TP_STARTING);
+			m_vect_threads.push_back(std::thread([this, i, fn_on_start = m_fn_on_thread_start, fn_on_stop = m_fn_on_thread_stop](void) { idle_thread(i, fn_on_start, fn_on_stop); }));
+		} // end for i
+
+		ma_u_li_nrunning = m_vect_threads.size();
+
+		// threads that just started may have stood by before they were counted as running
+		wake_standby();
+	} // end method start_threads
+
+
+	///<summary>
+	/// Retires the threads with an id of at least <paramref name="ku_li_N_THREADS_"/> and waits for them to terminate.
+	/// Must be called while holding <see cref="m_mtx_resize"/>.
+	///</summary>
+	///<param name="ku_li_N_THREADS_">The number of threads that should keep running.</param>
+	///<remarks>
+	/// The retired threads are joined without holding <see cref="m_mtx_threads"/>, 
+	/// so the jobs they are still executing may query the states of the pool's threads.
+	///</remarks>
+	void stop_threads(const std::size_t ku_li_N_THREADS_)
+	{
+		std::vector<std::thread> vect_retired;
+
+		{
+			Guard_t guard(m_mtx_threads);
+
+			for (std::size_t i = ku_li_N_THREADS_; i < ma_u_li_nrunning; i++)
+			{
+				m_vect_workers[i]->ma_e_signal.store(THREAD_SIGNALS::TP_SIGTERM, std::memory_order_release);
+				vect_retired.push_back(std::move(m_vect_threads[i]));
+			} // end for i
+
+			// the threads with the highest ids are the compensating ones
+			const std::size_t ku_li_NREGULAR = ma_u_li_nrunning - ma_u_li_ncompensating.load();
+
+			m_vect_threads.resize(std::min(ku_li_N_THREADS_, m_vect_threads.size()));
+			ma_u_li_nrunning = m_vect_threads.size();
+			ma_u_li_ncompensating.store(ma_u_li_nrunning > ku_li_NREGULAR ? ma_u_li_nrunning - ku_li_NREGULAR : 0);
+		} // end Guard_t
+
+		wake_all();
+
+		for (auto& t : vect_retired)
+		{
+			if (t.joinable() == true)
+			{
+				t.join();
+			} // end if
+		} // end for t
+	} // end method stop_threads
+
+
+	///<summary>
+	/// Starts the thread adjusting the number of threads in elastic mode and starting compensating threads, 
+	/// unless it is running already or has nothing to do. Must be called while holding <see cref="m_mtx_resize"/>.
+	///</summary>
+	void start_manager(void)
+	{
+		if ((mu_li_max_threads == 0 && mu_li_max_compensating == 0) || m_thread_manager.joinable() == true)
+		{
+			return;
+		} // end if
+
+		mb_stop_manager = false;
+		mb_compensate = ma_u_li_nblocking.load() > ma_u_li_ncompensating.load();
+		m_thread_manager = std::thread([this](void) { manage_threads(); });
+	} // end method start_manager
+
+
+	///<summary>
+	/// Stops the manager thread and waits for it to terminate, if it is running.
+	///</summary>
+	void stop_manager(void)
+	{
+		std::thread thread_manager;
+
+		{
+			Guard_t guard(m_mtx_resize);
+			thread_manager = std::move(m_thread_manager);
+		} // end Guard_t
+
+		{
+			Guard_t guard(m_mtx_manager);
+			mb_stop_manager = true;
+		} // end Guard_t
+
+		m_cv_manager.notify_all();
+
+		if (thread_manager.joinable() == true)
+		{
+			thread_manager.join();
+		} // end if
+	} // end method stop_manager
+
+
+	///<summary>
+	/// Main function of the manager thread, starts compensating threads whenever threads enter blocking regions, 
+	/// and in elastic mode checks the pool every <see cref="Settings::dur_spawn_wait"/>, until it is stopped.
+	///</summary>
+	void manage_threads(void)
+	{
+		Lock_t lock(m_mtx_manager);
+		bool b_backlog = false;
+		const auto k_fn_WAKE = [this](void) { return mb_stop_manager == true || mb_compensate == true; };
+
+		while (mb_stop_manager == false)
+		{
+			if (mu_li_max_threads == 0)
+			{
+				m_cv_manager.wait(lock, k_fn_WAKE);
+			} // end if
+			else
+			{
+				m_cv_manager.wait_for(lock, m_dur_spawn_wait, k_fn_WAKE);
+			} // end else
+
+			if (mb_stop_manager == true)
+			{
+				break;
+			} // end if
+
+			const bool kb_COMPENSATE = mb_compensate;
+
+			mb_compensate = false;
+			lock.unlock();
+
+			if (kb_COMPENSATE == true)
+			{
+				Guard_t guard(m_mtx_resize);
+
+				compensate();
+			} // end if
+			else
+			{
+				b_backlog = adjust_threads(b_backlog);
+			} // end else
+
+			lock.lock();
+		} // end while
+	} // end method manage_threads
+
+
+	///<summary>
+	/// Adds threads if jobs are waiting while no thread is idle, or retires threads that have been idle for too long.
+	///</summary>
+	///<param name="kb_BACKLOG_">Whether or not jobs were waiting while no thread was idle at the last check.</param>
+	///<returns>Whether or not jobs are waiting while no thread is idle.</returns>
+	///<remarks>
+	/// Threads are added if the backlog persisted since the last check, or at once if more than 
+	/// <see cref="Settings::u_li_spawn_depth"/> jobs are waiting, one thread per that many jobs.
+	/// Only threads with the highest ids are retired, so the ids of running threads stay contiguous.
+	///</remarks>
+	bool adjust_threads(const bool kb_BACKLOG_)
+	{
+		Guard_t guard(m_mtx_resize);
+		const std::size_t ku_li_NRUNNING = ma_u_li_nrunning;
+		const auto k_NOW = std::chrono::steady_clock::now().time_since_epoch().count();
+		const auto k_TIMEOUT = std::chrono::duration_cast<std::chrono::steady_clock::duration>(m_dur_idle_timeout).count();
+		std::size_t u_li_nidle = 0;
+		std::size_t u_li_nexpired = 0;
+		bool b_top = true;
+
+		for (std::size_t i = ku_li_NRUNNING; i-- > 0;)
+		{
+			const Worker_t& k_worker = *m_vect_workers[i];
+			const bool kb_IDLE = k_worker.ma_e_signal.load(std::memory_order_acquire) == THREAD_SIGNALS::TP_IDLE;
+
+			u_li_nidle += kb_IDLE ? 1 : 0;
+			b_top = b_top && kb_IDLE && k_NOW - k_worker.ma_li_idle_since.load(std::memory_order_relaxed) >= k_TIMEOUT;
+			u_li_nexpired += b_top ? 1 : 0;
+		} // end for i
+
+		const std::size_t ku_li_NWAITING = n_waiting();
+		const bool kb_BACKLOG = ku_li_NWAITING != 0 && u_li_nidle == 0;
+
+		if (kb_BACKLOG == true && (kb_BACKLOG_ == true || ku_li_NWAITING > mu_li_spawn_depth) && ku_li_NRUNNING < mu_li_max_threads)
+		{
+			const std::size_t ku_li_NNEW = std::max<std::size_t>(ku_li_NWAITING / (mu_li_spawn_depth + 1), 1);
+
+			start_threads(std::min(ku_li_NRUNNING + ku_li_NNEW, mu_li_max_threads));
+		} // end if
+		else if (u_li_nexpired != 0 && ku_li_NRUNNING > mu_li_min_threads)
+		{
+			stop_threads(std::max(ku_li_NRUNNING - u_li_nexpired, mu_li_min_threads));
+		} // end elif
+
+		return kb_BACKLOG;
+	} // end method adjust_threads
+
+
+	///<summary>
+	/// Returns the number of jobs waiting in the shared queues and the deques of all threads.
+	///</summary>
+	///<returns>The approximate number of jobs waiting for execution.</returns>
+	std::size_t n_waiting(void) const noexcept
+	{
+		std::size_t u_li_out = n_queued();
+
+		for (auto p_worker : *ma_p_workers.load(std::memory_order_acquire))
+		{
+			u_li_out += p_worker->m_deque_jobs.Size();
+		} // end for p_worker
+
+		return u_li_out;
+	} // end method n_waiting
+
+
+	///<summary>
+	/// Schedules <paramref name="fn_job_"/> to be added at <paramref name="k_due_"/>, starting the timer thread unless it is running.
+	///</summary>
+	///<param name="fn_job_">The job to schedule.</param>
+	///<param name="k_due_">The point in time at which the job is added first.</param>
+	///<param name="ku_li_PERIOD_">The number of ticks between two executions, 0 for a job added once.</param>
+	///<param name="ke_PRIORITY_">The priority of the job.</param>
+	///<returns>A handle to the scheduled job.</returns>
+	Timer_Handle schedule(Job_t fn_job_, const std::chrono::steady_clock::time_point& k_due_, const std::uint64_t ku_li_PERIOD_, const JOB_PRIORITIES ke_PRIORITY_)
+	{
+		std::shared_ptr<Timer_t> p_timer = std::allocate_shared<Timer_t>(Allocator_t<Timer_t>(this), std::move(fn_job_), ku_li_PERIOD_, ke_PRIORITY_);
+		const std::uint64_t ku_li_DUE = k_due_ > m_tp_timer_epoch ? std::chrono::ceil<std::chrono::milliseconds>(k_due_ - m_tp_timer_epoch) / M_TIMER_TICK : 0;
+
+		Guard_t guard(m_mtx_timers);
+
+		if (m_thread_timer.joinable() == false)
+		{
+			m_thread_timer = std::thread([this](void) { run_timers(); });
+		} // end if
+
+		arm_timer(p_timer, ku_li_DUE);
+
+		return Timer_Handle(std::move(p_timer));
+	} // end method schedule
+
+
+	///<summary>
+	/// Adds <paramref name="p_timer_"/> to the timer wheel to be due at tick <paramref name="ku_li_DUE_"/>,
+	/// and wakes the timer thread if it sleeps past that tick. Must be called while holding <see cref="m_mtx_timers"/>.
+	///</summary>
+	void arm_timer(const std::shared_ptr<Timer_t>& p_timer_, const std::uint64_t ku_li_DUE_)
+	{
+		p_timer_->mu_li_due = ku_li_DUE_;
+		m_wheel_timers.Insert(ku_li_DUE_, p_timer_);
+
+		if (ku_li_DUE_ < mu_li_timer_wakeup)
+		{
+			mu_li_timer_wakeup = ku_li_DUE_;
+			m_cv_timers.notify_one();
+		} // end if
+	} // end method arm_timer
+
+
+	///<summary>
+	/// Main function of the timer thread, advances the timer wheel and adds the jobs that are due,
+	/// sleeping until the next tick the wheel has to be advanced to in between.
+	///</summary>
+	void run_timers(void)
+	{
+		std::vector<std::shared_ptr<Timer_t>> vect_due;
+		Lock_t lock(m_mtx_timers);
+
+		// stop_timers moves the thread out, a thread started afterwards does not stop this one from terminating
+		while (m_thread_timer.get_id() == std::this_thread::get_id())
+		{
+			m_wheel_timers.Advance(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_tp_timer_epoch) / M_TIMER_TICK, vect_due);
+
+			if (vect_due.empty() == false)
+			{
+				// jobs armed meanwhile are seen before sleeping again
+				mu_li_timer_wakeup = 0;
+				lock.unlock();
+
+				for (auto& p_timer : vect_due)
+				{
+					dispatch_timer(p_timer);
+				} // end for p_timer
+
+				vect_due.clear();
+				lock.lock();
+			} // end if
+			else if (m_wheel_timers.Empty() == true)
+			{
+				mu_li_timer_wakeup = UINT64_MAX;
+				m_cv_timers.wait(lock);
+			} // end if
+			else
+			{
+				mu_li_timer_wakeup = m_wheel_timers.Next_Tick();
+				m_cv_timers.wait_until(lock, m_tp_timer_epoch + mu_li_timer_wakeup * M_TIMER_TICK);
+			} // end else
+		} // end while
+	} // end method run_timers
+
+
+	///<summary>
+	/// Adds the job of <paramref name="p_timer_"/> to the queue, a job added once is consumed,
+	/// a periodic job is added with a job executing it once, see <see cref="run_periodic"/>.
+	///</summary>
+	///<remarks>
+	/// The timer thread never waits for room, which would delay all other timers, due jobs that do not fit 
+	/// a full ring go to its overflow queue instead, see <see cref="push_forced"/>.
+	///</remarks>
+	void dispatch_timer(const std::shared_ptr<Timer_t>& p_timer_)
+	{
+		if (p_timer_->mu_li_period == 0)
+		{
+			auto e_state = Timer_t::TP_TIMER_PENDING;
+
+			if (p_timer_->ma_e_state.compare_exchange_strong(e_state, Timer_t::TP_TIMER_DONE, std::memory_order_acq_rel) == true)
+			{
+				push_forced(p_timer_->m_job, p_timer_->me_priority);
+			} // end if
+		} // end if
+		else if (p_timer_->ma_e_state.load(std::memory_order_acquire) == Timer_t::TP_TIMER_PENDING)
+		{
+			Job_t fn_job_periodic(Timer_Run_t(this, p_timer_));
+
+			push_forced(fn_job_periodic, p_timer_->me_priority);
+		} // end if
+	} // end method dispatch_timer
+
+
+	///<summary>
+	/// Executes the periodic job <paramref name="p_timer_"/> once and schedules its next execution unless it was cancelled.
+	///</summary>
+	///<remarks>
+	/// Executions that were due while the job was executing are skipped, the next one stays aligned to the period.
+	///</remarks>
+	void run_periodic(const std::shared_ptr<Timer_t>& p_timer_)
+	{
+		if (p_timer_->ma_e_state.load(std::memory_order_acquire) != Timer_t::TP_TIMER_PENDING)
+		{
+			return;
+		} // end if
+
+		try
+		{
+			p_timer_->m_job();
+		} // end try
+		catch (...) // the job is executed again regardless
+		{
+			report_exception(std::current_exception());
+		} // end catch all
+
+		Guard_t guard(m_mtx_timers);
+
+		// the pool was shut down while the job was executing
+		if (m_thread_timer.joinable() == false)
+		{
+			p_timer_->Cancel();
+			return;
+		} // end if
+
+		if (p_timer_->ma_e_state.load(std::memory_order_acquire) == Timer_t::TP_TIMER_PENDING)
+		{
+			const std::uint64_t ku_li_NOW = m_wheel_timers.Now();
+			std::uint64_t u_li_due = p_timer_->mu_li_due + p_timer_->mu_li_period;
+
+			if (u_li_due <= ku_li_NOW)
+			{
+				u_li_due += ((ku_li_NOW - u_li_due) / p_timer_->mu_li_period + 1) * p_timer_->mu_li_period;
+			} // end if
+
+			arm_timer(p_timer_, u_li_due);
+		} // end if
+	} // end method run_periodic
+
+
+	///<summary>
+	/// Adds <paramref name="fn_job_"/> to the queue of <paramref name="executor_"/> and a token to the queue of the pool
+	/// if the job could be executed right away.
+	///</summary>
+	void add_executor_job(Executor_t& executor_, Job_t&& fn_job_)
+	{
+		std::size_t u_li_ntokens = 0;
+
+		{
+			Guard_t guard(m_mtx_executors);
+			const std::size_t ku_li_RUNNABLE = executor_.N_Runnable();
+
+			executor_.m_q_jobs.push(std::move(fn_job_));
+			mu_li_executor_runnable += executor_.N_Runnable() - ku_li_RUNNABLE;
+			u_li_ntokens = issue_executor_tokens();
+		} // end Guard_t
+
+		for (std::size_t i = 0; i < u_li_ntokens; i++)
+		{
+			Add_Job(Executor_Run_t(this));
+		} // end for i
+	} // end method add_executor_job
+
+
+	///<summary>
+	/// Counts the tokens needed for every executor job that could be executed to have one, must be called while holding <see cref="m_mtx_executors"/>.
+	///</summary>
+	///<returns>The number of tokens the caller adds to the queue of the pool after releasing the mutex.</returns>
+	std::size_t issue_executor_tokens(void) noexcept
+	{
+		if (mu_li_executor_runnable <= mu_li_executor_tokens)
+		{
+			return 0;
+		} // end if
+
+		const std::size_t ku_li_NTOKENS = mu_li_executor_runnable - mu_li_executor_tokens;
+
+		mu_li_executor_tokens += ku_li_NTOKENS;
+
+		return ku_li_NTOKENS;
+	} // end method issue_executor_tokens
+
+
+	///<summary>
+	/// Picks the executor whose job a token executes by deficit round robin, must be called while holding <see cref="m_mtx_executors"/>.
+	///</summary>
+	///<returns>The executor, nullptr if no executor has a job that could be executed.</returns>
+	///<remarks>
+	/// The executor at the cursor keeps being picked until it used up a quantum of as many jobs as its weight or has 
+	/// no job left to execute, the next executor then receives a new quantum. Executors without jobs forfeit their quantum.
+	///</remarks>
+	Executor_t* next_executor(void) noexcept
+	{
+		if (mu_li_executor_runnable == 0)
+		{
+			return nullptr;
+		} // end if
+
+		while (true)
+		{
+			Executor_t& executor = *m_vect_executors[mu_li_executor_cursor];
+
+			if (executor.mu_li_deficit != 0 && executor.N_Runnable() != 0)
+			{
+				executor.mu_li_deficit--;
+				return &executor;
+			} // end if
+
+			executor.mu_li_deficit = 0;
+			mu_li_executor_cursor = (mu_li_executor_cursor + 1) % m_vect_executors.size();
+			m_vect_executors[mu_li_executor_cursor]->mu_li_deficit = m_vect_executors[mu_li_executor_cursor]->mu_li_weight;
+		} // end while
+	} // end method next_executor
+
+
+	///<summary>
+	/// Executes the next job of the executor picked by <see cref="next_executor"/>, called by a token.
+	///</summary>
+	///<remarks>
+	/// Exceptions thrown by the job are reported. Once the job completed, the tokens its executor can use again are added,
+	/// before the token completes, so executor jobs keep counting as pending while their executor has queued jobs.
+	///</remarks>
+	void run_executor_job(void)
+	{
+		Executor_t* p_executor = nullptr;
+		Job_t fn_job;
+
+		{
+			Guard_t guard(m_mtx_executors);
+
+			mu_li_executor_tokens--;
+			p_executor = next_executor();
+
+			// the jobs were discarded, or another token took them
+			if (p_executor == nullptr)
+			{
+				return;
+			} // end if
+
+			const std::size_t ku_li_RUNNABLE = p_executor->N_Runnable();
+
+			fn_job = std::move(p_executor->m_q_jobs.front());
+			p_executor->m_q_jobs.pop();
+			p_executor->mu_li_nrunning++;
+			mu_li_executor_runnable -= ku_li_RUNNABLE - p_executor->N_Runnable();
+		} // end Guard_t
+
+		try
+		{
+			fn_job();
+		} // end try
+		catch (...)
+		{
+			report_exception(std::current_exception());
+		} // end catch all
+
+		// the job is completed only once the state it captured is destroyed
+		fn_job = nullptr;
+
+		std::size_t u_li_ntokens = 0;
+
+		{
+			Guard_t guard(m_mtx_executors);
+			const std::size_t ku_li_RUNNABLE = p_executor->N_Runnable();
+
+			p_executor->mu_li_nrunning--;
+			mu_li_executor_runnable += p_executor->N_Runnable() - ku_li_RUNNABLE;
+			u_li_ntokens = issue_executor_tokens();
+		} // end Guard_t
+
+		for (std::size_t i = 0; i < u_li_ntokens; i++)
+		{
+			Job_t fn_job_token(Executor_Run_t(this));
+
+			push_forced(fn_job_token);
+		} // end for i
+	} // end method run_executor_job
+
+
+	///<summary>
+	/// Adds <paramref name="fn_job_"/> to the end of <paramref name="p_strand_"/>, and the strand to the queue of the pool
+	/// unless it is queued or executing already.
+	///</summary>
+	///<remarks>
+	/// If adding the strand throws, the strand is not scheduled anymore and the exception is rethrown, 
+	/// so the next job added schedules the strand again.
+	///</remarks>
+	void add_strand_job(const std::shared_ptr<Strand_t>& p_strand_, Job_t&& fn_job_)
+	{
+		std::size_t u_li_nscheduled = 0;
+
+		{
+			Guard_t guard(p_strand_->m_mtx);
+
+			p_strand_->m_q_jobs.push(std::move(fn_job_));
+
+			if (p_strand_->mb_scheduled == true)
+			{
+				return;
+			} // end if
+
+			p_strand_->mb_scheduled = true;
+			u_li_nscheduled = ++p_strand_->mu_li_nscheduled;
+		} // end Guard_t
+
+		try
+		{
+			Add_Job(Strand_Run_t(this, p_strand_));
+		} // end try
+		catch (...)
+		{
+			Guard_t guard(p_strand_->m_mtx);
+
+			// the discarded job of the strand may have reset the flag already, and another thread scheduled the strand since
+			if (p_strand_->mu_li_nscheduled == u_li_nscheduled)
+			{
+				p_strand_->mb_scheduled = false;
+			} // end if
+
+			throw;
+		} // end catch all
+	} // end method add_strand_job
+
+
+	///<summary>
+	/// Executes the next job of <paramref name="p_strand_"/>, or the next batch of jobs if it is sticky, 
+	/// and adds the strand to the queue of the pool again if it has jobs left.
+	///</summary>
+	///<remarks>
+	/// Exceptions thrown by the jobs are reported. The strand is added again before the job executing it completes,
+	/// so the jobs of strands keep counting as pending while their strand has queued jobs. 
+	/// In work stealing mode, a sticky strand goes to the deque of the thread, which takes it again unless it is stolen,
+	/// while other strands go to the end of the shared queue, so they do not keep the thread from its other jobs.
+	/// Neither waits for room in the queue, see <see cref="push_forced"/>.
+	///</remarks>
+	void run_strand(const std::shared_ptr<Strand_t>& p_strand_)
+	{
+		const std::size_t ku_li_NJOBS = p_strand_->mb_sticky == true ? M_STRAND_BATCH_SIZE : 1;
+
+		for (std::size_t i = 0; i < ku_li_NJOBS; i++)
+		{
+			Job_t fn_job;
+
+			{
+				Guard_t guard(p_strand_->m_mtx);
+
+				if (p_strand_->m_q_jobs.empty() == true)
+				{
+					p_strand_->mb_scheduled = false;
+					return;
+				} // end if
+
+				fn_job = std::move(p_strand_->m_q_jobs.front());
+				p_strand_->m_q_jobs.pop();
+			} // end Guard_t
+
+			try
+			{
+				fn_job();
+			} // end try
+			catch (...)
+			{
+				report_exception(std::current_exception());
+			} // end catch all
+
+			// the state the job captured is destroyed before the next job of the strand starts
+			fn_job = nullptr;
+		} // end for i
+
+		{
+			Guard_t guard(p_strand_->m_mtx);
+
+			if (p_strand_->m_q_jobs.empty() == true)
+			{
+				p_strand_->mb_scheduled = false;
+				return;
+			} // end if
+		} // end Guard_t
+
+		Job_t fn_job_strand(Strand_Run_t(this, p_strand_));
+
+		push_forced(fn_job_strand, JOB_PRIORITIES::TP_PRIORITY_NORMAL, p_strand_->mb_sticky == false);
+	} // end method run_strand
+
+
+	///<summary>
+	/// Stops the timer thread and waits for it to terminate, if it is running, and cancels all scheduled jobs.
+	///</summary>
+	void stop_timers(void)
+	{
+		std::thread thread_timer;
+		std::vector<std::shared_ptr<Timer_t>> vect_timers;
+
+		{
+			Guard_t guard(m_mtx_timers);
+
+			thread_timer = std::move(m_thread_timer);
+			m_wheel_timers.Clear(vect_timers);
+		} // end Guard_t
+
+		m_cv_timers.notify_all();
+
+		if (thread_timer.joinable() == true)
+		{
+			thread_timer.join();
+		} // end if
+
+		for (auto& p_timer : vect_timers)
+		{
+			p_timer->Cancel();
+		} // end for p_timer
+	} // end method stop_timers
+
+
+	///<summary>
+	/// Increments a counter that is only ever written by the calling thread.
+	///</summary>
+	///<param name="a_u_li_counter_">The counter to increment.</param>
+	static void increment(std::atomic<std::size_t>& a_u_li_counter_) noexcept
+	{
+		a_u_li_counter_.store(a_u_li_counter_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	} // end method increment
+
+
+	///<summary>
+	/// Returns whether or not the calling thread of this pool received a sigterm.
+	///</summary>
+	///<returns>True iff the thread was told to terminate.</returns>
+	bool is_terminating(void) const noexcept
+	{
+		return ts_p_worker->ma_e_signal.load(std::memory_order_acquire) == THREAD_SIGNALS::TP_SIGTERM;
+	} // end method is_terminating
+
+
+	///<summary>
+	/// Sets the signal of the calling thread of this pool, unless it received a sigterm.
+	///</summary>
+	///<param name="e_SIGNAL_">The new signal of the thread.</param>
+	///<remarks>
+	/// Only the owning thread and <see cref="signal_all"/> write the signal, the compare exchange
+	/// makes sure a sigterm is never overwritten. The signal is not written if it is unchanged, 
+	/// so a busy thread does not keep invalidating the cache line for readers of its state.
+	///</remarks>
+	void set_signal(const THREAD_SIGNALS e_SIGNAL_) noexcept
+	{
+		std::atomic<THREAD_SIGNALS>& a_e_signal = ts_p_worker->ma_e_signal;
+		THREAD_SIGNALS e_current = a_e_signal.load(std::memory_order_relaxed);
+
+		while (e_current != e_SIGNAL_ && e_current != THREAD_SIGNALS::TP_SIGTERM)
+		{
+			if (a_e_signal.compare_exchange_weak(e_current, e_SIGNAL_, std::memory_order_release, std::memory_order_relaxed) == true)
+			{
+				break;
+			} // end if
+		} // end while
+	} // end method set_signal
+
+
+	///<summary>
+	/// Sets the signal of every running thread to <paramref name="ke_SIGNAL_"/>.
+	///</summary>
+	///<param name="ke_SIGNAL_">The new signal of all threads.</param>
+	void signal_all(const THREAD_SIGNALS ke_SIGNAL_)
+	{
+		Guard_t guard(m_mtx_threads);
+
+		for (std::size_t i = 0; i < ma_u_li_nrunning; i++)
+		{
+			m_vect_workers[i]->ma_e_signal.store(ke_SIGNAL_, std::memory_order_release);
+		} // end for i
+	} // end method signal_all
+
+
+private:
+	///<summary>
+	/// Counters of one thread of the pool, or of all threads outside the pool.
+	///</summary>
+	///<remarks>
+	/// The counters of a thread of the pool are only written by that thread, so they are updated without 
+	/// read-modify-write operations, like the completion counters. The counters of threads outside the pool are shared.
+	///</remarks>
+	struct Metrics_t
+	{
+		std::atomic<std::size_t> ma_u_li_nexecuted;                              //! the number of jobs executed
+		std::atomic<std::size_t> ma_u_li_nstolen;                                //! the number of jobs stolen
+		std::atomic<std::size_t> ma_u_li_deque_high_water;                       //! the largest number of jobs seen in the deque
+		std::atomic<std::size_t> ma_u_li_busy_ns;                                //! nanoseconds spent executing jobs
+		std::atomic<std::size_t> ma_u_li_idle_ns;                                //! nanoseconds spent looking or waiting for jobs
+		std::atomic<std::size_t> ma_arr_u_li_latency[M_N_HISTOGRAM_BUCKETS];     //! histogram of the latencies of jobs
+		std::atomic<std::size_t> ma_arr_u_li_execution[M_N_HISTOGRAM_BUCKETS];   //! histogram of the execution times of jobs
+		const bool               mb_exclusive;                                   //! whether or not only one thread writes the counters
+
+		explicit Metrics_t(const bool kb_EXCLUSIVE_)
+			: ma_u_li_nexecuted(0), ma_u_li_nstolen(0), ma_u_li_deque_high_water(0), ma_u_li_busy_ns(0), ma_u_li_idle_ns(0), mb_exclusive(kb_EXCLUSIVE_)
+		{
+			for (std::size_t i = 0; i < M_N_HISTOGRAM_BUCKETS; i++)
+			{
+				ma_arr_u_li_latency[i].store(0, std::memory_order_relaxed);
+				ma_arr_u_li_execution[i].store(0, std::memory_order_relaxed);
+			} // end for i
+		} // end Constructor
+
+		///<summary>
+		/// Adds <paramref name="ku_li_DELTA_"/> to one of the counters.
+		///</summary>
+		void Add(std::atomic<std::size_t>& a_u_li_counter_, const std::size_t ku_li_DELTA_) noexcept
+		{
+			if (mb_exclusive == true)
+			{
+				a_u_li_counter_.store(a_u_li_counter_.load(std::memory_order_relaxed) + ku_li_DELTA_, std::memory_order_relaxed);
+			} // end if
+			else
+			{
+				a_u_li_counter_.fetch_add(ku_li_DELTA_, std::memory_order_relaxed);
+			} // end else
+		} // end method Add
+
+		///<summary>
+		/// Counts a duration of <paramref name="u_li_ns_"/> nanoseconds in one of the histograms.
+		///</summary>
+		void Record(std::atomic<std::size_t> (&arr_a_u_li_histogram_)[M_N_HISTOGRAM_BUCKETS], std::size_t u_li_ns_) noexcept
+		{
+			std::size_t u_li_bucket = 0;
+
+			while (u_li_ns_ > 1 && u_li_bucket < M_N_HISTOGRAM_BUCKETS - 1)
+			{
+				u_li_ns_ >>= 1;
+				u_li_bucket++;
+			} // end while
+
+			Add(arr_a_u_li_histogram_[u_li_bucket], 1);
+		} // end method Record
+
+		///<summary>
+		/// Copies all counters to <paramref name="stats_"/>.
+		///</summary>
+		void Snapshot(Worker_Stats& stats_) const noexcept
+		{
+			stats_.u_li_nexecuted = ma_u_li_nexecuted.load(std::memory_order_relaxed);
+			stats_.u_li_nstolen = ma_u_li_nstolen.load(std::memory_order_relaxed);
+			stats_.u_li_deque_high_water = ma_u_li_deque_high_water.load(std::memory_order_relaxed);
+			stats_.dur_busy = std::chrono::nanoseconds(ma_u_li_busy_ns.load(std::memory_order_relaxed));
+			stats_.dur_idle = std::chrono::nanoseconds(ma_u_li_idle_ns.load(std::memory_order_relaxed));
+
+			for (std::size_t i = 0; i < M_N_HISTOGRAM_BUCKETS; i++)
+			{
+				stats_.hist_latency.arr_u_li_counts[i] = ma_arr_u_li_latency[i].load(std::memory_order_relaxed);
+				stats_.hist_execution.arr_u_li_counts[i] = ma_arr_u_li_execution[i].load(std::memory_order_relaxed);
+			} // end for i
+		} // end method Snapshot
+
+		///<summary>
+		/// Raises <paramref name="a_u_li_max_"/> to <paramref name="ku_li_VALUE_"/> if it is lower.
+		///</summary>
+		static void Raise(std::atomic<std::size_t>& a_u_li_max_, const std::size_t ku_li_VALUE_) noexcept
+		{
+			std::size_t u_li_max = a_u_li_max_.load(std::memory_order_relaxed);
+
+			while (u_li_max < ku_li_VALUE_ && a_u_li_max_.compare_exchange_weak(u_li_max, ku_li_VALUE_, std::memory_order_relaxed) == false)
+			{
+			} // end while
+		} // end method Raise
+
+		///<summary>
+		/// Converts <paramref name="k_duration_"/> to nanoseconds, negative durations become 0.
+		///</summary>
+		template <class Rep, class Period>
+		static std::size_t Nanoseconds(const std::chrono::duration<Rep, Period>& k_duration_) noexcept
+		{
+			const auto k_NS = std::chrono::duration_cast<std::chrono::nanoseconds>(k_duration_).count();
+
+			return k_NS > 0 ? static_cast<std::size_t>(k_NS) : 0;
+		} // end method Nanoseconds
+	}; // end struct Metrics_t
+
+
+	///<summary>
+	/// Stands in for the counters in configurations without metrics, it takes no space.
+	///</summary>
+	struct No_Metrics_t
+	{
+		explicit No_Metrics_t(const bool) noexcept
+		{
+		} // end Constructor
+	}; // end struct No_Metrics_t
+
+
+	using Metrics_Storage_t = std::conditional_t<M_METRICS, Metrics_t, No_Metrics_t>;
+
+
+	///<summary>
+	/// State kept for every thread of the pool.
+	///</summary>
+	///<remarks>
+	/// Every worker state starts on its own cache line, and the fields written by the owning thread 
+	/// are kept off the cache lines of the deque that stealers write to.
+	///</remarks>
+	struct alignas(M_CACHE_LINE_SIZE) Worker_t
+	{
+		Work_Stealing_Deque<Job_t*, M_CACHE_LINE_SIZE> m_deque_jobs; //! jobs added by this thread in work stealing mode
+		Slab_Arena                  m_arena;              //! the arena jobs and shared states created by this thread are allocated from
+		alignas(M_CACHE_LINE_SIZE) std::atomic<THREAD_SIGNALS> ma_e_signal; //! the state of this thread, written by the thread and to send sigterms
+		std::atomic<std::size_t>    ma_u_li_nsubmitted;   //! the number of jobs submitted by this thread
+		std::atomic<std::size_t>    ma_u_li_ncompleted;   //! the number of jobs completed by this thread
+		std::uint32_t               mu_rng;               //! state used to pick steal victims
+		std::size_t                 mu_li_id;             //! the id of the thread within the thread pool
+		std::size_t                 mu_li_npops;          //! the number of jobs this thread took from the shared queue
+		std::size_t                 mu_li_cpu;            //! the CPU this thread is pinned to, only used if threads are pinned
+		std::size_t                 mu_li_node;           //! the NUMA node of the CPU, 0 if threads are not pinned
+		std::atomic<std::chrono::steady_clock::rep> ma_li_idle_since; //! the time this thread last became idle, only kept in elastic mode
+		std::shared_ptr<void>       mp_context;           //! the context of the jobs executed by this thread, only accessed by the thread
+		const std::type_info*       mp_context_type;      //! the type of the context, nullptr without context
+		std::size_t                 mu_li_blocking_depth; //! the number of blocking regions the thread is in
+#if __has_cpp_attribute(no_unique_address)
+		[[no_unique_address]] Metrics_Storage_t m_metrics; //! the counters of this thread, empty without metrics
+#else
+		Metrics_Storage_t           m_metrics;            //! the counters of this thread, empty without metrics
+#endif
+#ifdef THREAD_POOL_ENABLE_TRACING
+		Trace_Buffer                m_trace{ M_TRACE_BUFFER_SIZE }; //! the events recorded by this thread, only written by the thread
+#endif
+
+		Worker_t(const std::size_t ku_li_ID_, Slab_Arena::Resource_t* p_resource_)
+			: m_arena(p_resource_), ma_e_signal(THREAD_SIGNALS::TP_STARTING), ma_u_li_nsubmitted(0), ma_u_li_ncompleted(0), mu_rng(static_cast<std::uint32_t>(ku_li_ID_ * 2654435761u) | 1u), mu_li_id(ku_li_ID_), mu_li_npops(0), mu_li_cpu(0), mu_li_node(0), ma_li_idle_since(0), mp_context_type(nullptr), mu_li_blocking_depth(0), m_metrics(true)
+		{
+		} // end Constructor
+
+		~Worker_t(void)
+		{
+			Job_t* p_job = nullptr;
+
+			while (m_deque_jobs.Pop(p_job) == true)
+			{
+				delete_job(p_job);
+			} // end while
+		} // end Destructor
+	}; // end struct Worker_t
+
+
+	using Job_Queue_t = std::queue<Job_t, std::deque<Job_t, Arena_Allocator<Job_t>>>;
+
+
+	///<summary>
+	/// The shared queues of one NUMA node, one queue per priority.
 	///</summary>
-	///<param name="ku_li_N_THREADS_">The number of threads to start.</param>
-	///<returns>
-	/// True on success, false if an issue occurs. 
-	///</returns>
 	///<remarks>
-	/// The value of <paramref name="ku_li_N_THREADS_"/> must be at least as large as 
-	/// the number of running threads in order for this call to succeed.
-	/// By providing an <paramref name="ku_li_N_THREADS_"/> value larger than the capacity
-	/// of the thread pool, the pool can be grown in size.
+	/// Without node queues, the pool has exactly one of these. Every node queue starts on its own 
+	/// cache line, so producers and consumers on different nodes don't contend for the same lines.
 	///</remarks>
-	bool Start_N_Threads(const std::size_t ku_li_N_THREADS_)
+	struct alignas(M_CACHE_LINE_SIZE) Node_Queue_t
 	{
-		if (ku_li_N_THREADS_ < mu_li_nrunning)
-		{
-			return false;
-		} // end if
-		else if (ku_li_N_THREADS_ > mu_li_nthreads)
-		{
-			mu_li_nthreads = ku_li_N_THREADS_;
-		} // end elif
+		std::mutex                          m_mtx_tasks;                            //! mutex protecting the locked queues and their arena
+		Slab_Arena                          m_arena_tasks;                          //! the arena the locked queues allocate from, protected by m_mtx_tasks
+		Job_Queue_t                         m_arr_q_tasks[TP_N_PRIORITIES];         //! queues storing tasks waiting for execution, one per priority, the overflow of forced jobs with rings
+		std::unique_ptr<Ring_Buffer<Job_t, M_CACHE_LINE_SIZE>> m_arr_p_ring_tasks[TP_N_PRIORITIES]; //! ring buffers storing tasks waiting for execution, one per priority, if used
+		std::atomic<std::size_t>            ma_arr_u_li_nqueued[TP_N_PRIORITIES];   //! the number of jobs in the locked queue of every priority
+		std::atomic<std::size_t>            ma_u_li_high_water;                      //! the largest number of jobs seen in this node queue, only kept with metrics
 
-		if (mu_li_nrunning != mu_li_nthreads)
+		Node_Queue_t(const QUEUE_BACKENDS ke_QUEUE_, const std::size_t ku_li_CAPACITY_, Slab_Arena::Resource_t* p_resource_)
+			: m_arena_tasks(p_resource_),
+			m_arr_q_tasks{ Job_Queue_t(Arena_Allocator<Job_t>(&m_arena_tasks)), Job_Queue_t(Arena_Allocator<Job_t>(&m_arena_tasks)), Job_Queue_t(Arena_Allocator<Job_t>(&m_arena_tasks)) }
 		{
-			m_vect_threads.reserve(mu_li_nthreads);
+			static_assert(JOB_PRIORITIES::TP_N_PRIORITIES == 3, "every priority needs a queue drawing from the arena");
 
-			m_mtx_signals.lock();
-			for (auto i = mu_li_nrunning; i < mu_li_nthreads; i++)
-			{
-				std::size_t my_id = i;
-				m_vect_signals.push_back(THREAD_SIGNALS::TP_STARTING);
-				m_vect_threads.push_back(std::thread([this, my_id](void) {idle_thread(my_id); }));
-			} // end for i
+			ma_u_li_high_water.store(0);
 
-			mu_li_nrunning = m_vect_threads.size();
-			m_mtx_signals.unlock();
-		} // end if
+			for (std::size_t i = 0; i < JOB_PRIORITIES::TP_N_PRIORITIES; i++)
+			{
+				ma_arr_u_li_nqueued[i].store(0);
 
-		return true;
-	} // end method Start_N_Threads
+				if (ke_QUEUE_ == QUEUE_BACKENDS::TP_QUEUE_RING)
+				{
+					m_arr_p_ring_tasks[i].reset(new Ring_Buffer<Job_t, M_CACHE_LINE_SIZE>(ku_li_CAPACITY_));
+				} // end if
+			} // end for i
+		} // end Constructor
+	}; // end struct Node_Queue_t
 
 
 	///<summary>
-	/// Forcefully adds the given job <paramref name="fn_job_"/> to the end of the execution queue.
+	/// State shared by the jobs of one call of run_chunks.
 	///</summary>
-	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
-	void Add_Job_Force(Job_t fn_job_)
+	template <class Chunk_Fn>
+	struct Chunks_t
 	{
-		Guard_t guard(m_mtx_tasks);
+		Latch_t                                          m_latch;          //! counter of chunks that have not completed
+		Chunk_Fn&                                        m_fn_chunk;       //! the callable invoked with the index of every chunk
+		std::mutex                                       m_mtx_discarded;  //! mutex protecting m_vect_discarded
+		std::vector<std::pair<std::size_t, std::size_t>> m_vect_discarded; //! the ranges of chunks whose jobs were discarded without being executed
 
-		m_q_tasks.push(fn_job_);
-	} // end method Add_Job
+		Chunks_t(const std::size_t ku_li_NCHUNKS_, Chunk_Fn& fn_chunk_)
+			: m_latch(ku_li_NCHUNKS_), m_fn_chunk(fn_chunk_)
+		{
+		} // end Constructor
+	}; // end struct Chunks_t
 
 
 	///<summary>
-	/// Adds the given job <paramref name="fn_job_"/> to the end of the execution queue.
+	/// Job splitting and running a range of chunks, a job that is destroyed without being executed
+	/// leaves its range to the caller of run_chunks and counts it down.
 	///</summary>
-	///<remarks>
-	/// This function will block if more than the maximum number of jobs are waiting 
-	/// in the execution queue. Use <see="Add_Job_I" /> for non-blocking version.
-	///</remarks>
-	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
-	void Add_Job(Job_t fn_job_)
+	template <class Chunk_Fn>
+	struct Chunk_Run_t
 	{
-		while (m_q_tasks.size() >= M_MAX_JOB_COUNT)
+		BasicThreadPool*    mp_pool;     //! the pool running the chunks
+		Chunks_t<Chunk_Fn>* mp_chunks;   //! the state of the call, nullptr once executed or moved
+		std::size_t         mu_li_begin; //! the first chunk
+		std::size_t         mu_li_end;   //! one past the last chunk
+
+		Chunk_Run_t(BasicThreadPool* p_pool_, Chunks_t<Chunk_Fn>* p_chunks_, const std::size_t ku_li_BEGIN_, const std::size_t ku_li_END_) noexcept
+			: mp_pool(p_pool_), mp_chunks(p_chunks_), mu_li_begin(ku_li_BEGIN_), mu_li_end(ku_li_END_)
 		{
-			std::this_thread::yield();
-		} // end while
+		} // end Constructor(1)
 
+		Chunk_Run_t(Chunk_Run_t&& other_) noexcept
+			: mp_pool(other_.mp_pool), mp_chunks(std::exchange(other_.mp_chunks, nullptr)), mu_li_begin(other_.mu_li_begin), mu_li_end(other_.mu_li_end)
 		{
-			Guard_t(m_mtx_tasks);
-			m_q_tasks.push(fn_job_);
-		} // end Guard_t
-	} // end method Add_Job
+		} // end Constructor(2)
+
+		~Chunk_Run_t(void)
+		{
+			if (mp_chunks != nullptr)
+			{
+				{
+					Guard_t guard(mp_chunks->m_mtx_discarded);
+
+					mp_chunks->m_vect_discarded.emplace_back(mu_li_begin, mu_li_end);
+				} // end Guard_t
+
+				mp_chunks->m_latch.Count_Down(mu_li_end - mu_li_begin);
+			} // end if
+		} // end Destructor
+
+		void operator()(void)
+		{
+			mp_pool->split_chunks(*std::exchange(mp_chunks, nullptr), mu_li_begin, mu_li_end);
+		} // end operator()
+	}; // end struct Chunk_Run_t
 
 
 	///<summary>
-	/// Attempts to add the given job <paramref name="fn_job_"/> to the end of the execution 
-	/// queue. If successful, true is returned, otherwise false.
+	/// A job scheduled by Schedule_After, Schedule_At or Schedule_Every, shared by the timer wheel and its handles.
 	///</summary>
-	///<remarks>
-	/// This function will not block if more than the maximum number of jobs are waiting 
-	/// in the execution queue, instead it will return false. Use <see="Add_Job" /> for 
-	/// a blocking version.
-	///</remarks>
-	///<param name="fn_job_">A ready-to-execute job that should be executed.</param>
-	///<returns>True if the job was added, false otherwise.</returns>
-	bool Add_Job_I(Job_t fn_job_)
+	struct Timer_t
 	{
-		bool b_out = false;
-		if (m_q_tasks.size() < M_MAX_JOB_COUNT)
+		enum TIMER_STATES
 		{
-			{
-				Guard_t(m_mtx_tasks);
-				m_q_tasks.push(fn_job_);
-			} // end Guard_t
-			
-			b_out = true;
-		} // end while
+			TP_TIMER_PENDING = 0,
+			TP_TIMER_DONE,
+			TP_TIMER_CANCELLED
+		}; // end enum TIMER_STATES
 
-		return b_out;		
-	} // end method Add_Job_I
+		std::atomic<TIMER_STATES> ma_e_state;   //! whether the job will still be added, a periodic job stays pending until it is cancelled
+		Job_t                     m_job;        //! the job, moved to the queue if it is added once
+		JOB_PRIORITIES            me_priority;  //! the priority the job is added with
+		std::uint64_t             mu_li_period; //! the number of ticks between two executions, 0 for a job added once
+		std::uint64_t             mu_li_due;    //! the tick the job is due at next, protected by m_mtx_timers
+
+		Timer_t(Job_t&& fn_job_, const std::uint64_t ku_li_PERIOD_, const JOB_PRIORITIES ke_PRIORITY_)
+			: ma_e_state(TP_TIMER_PENDING), m_job(std::move(fn_job_)), me_priority(ke_PRIORITY_), mu_li_period(ku_li_PERIOD_), mu_li_due(0)
+		{
+		} // end Constructor
+
+		///<summary>
+		/// Marks the job as cancelled unless it was added or cancelled before.
+		///</summary>
+		///<returns>True if the job was pending.</returns>
+		bool Cancel(void) noexcept
+		{
+			TIMER_STATES e_state = TP_TIMER_PENDING;
+
+			return ma_e_state.compare_exchange_strong(e_state, TP_TIMER_CANCELLED, std::memory_order_acq_rel);
+		} // end method Cancel
+	}; // end struct Timer_t
 
 
 	///<summary>
-	/// Terminates all threads currently running in the thread pool. If <paramref name="b_SYNC_FIRST_"/> 
-	/// is set, the pool will sychronize before terminating the running threads.
+	/// Job executing a periodic job once, the periodic job is cancelled if this job is discarded without being executed.
 	///</summary>
-	///<param name="b_SYNC_FIRST_">Whether or not to block and synchronize before terminating.</param>
-	///<remarks>
-	/// The job queue will not be cleared by this function, an explicit call to Empty_Job_Queue is required.
-	///</remarks>
-	void Kill_All(const bool b_SYNC_FIRST_ = false)
+	struct Timer_Run_t
 	{
-		if (b_SYNC_FIRST_ == true)
+		BasicThreadPool*         mp_pool;  //! the pool the periodic job is scheduled on
+		std::shared_ptr<Timer_t> mp_timer; //! the periodic job, nullptr once executed or moved
+
+		Timer_Run_t(BasicThreadPool* p_pool_, std::shared_ptr<Timer_t> p_timer_) noexcept
+			: mp_pool(p_pool_), mp_timer(std::move(p_timer_))
 		{
-			Synchronize();
-		} // end if
+		} // end Constructor(1)
 
-		// signal all threads to terminate
-		m_mtx_signals.lock();
-		std::for_each(m_vect_signals.begin(), m_vect_signals.end(),
-			[&](auto& thread_signal)
-			{
-				thread_signal = THREAD_SIGNALS::TP_SIGTERM;
-			} // end lambda
-		); // end foreach
-		m_mtx_signals.unlock();
+		Timer_Run_t(Timer_Run_t&& other_) noexcept = default;
 
-		// wait for all threads to terminate
-		for (auto& t : m_vect_threads)
+		~Timer_Run_t(void)
 		{
-			if (t.joinable() == true)
+			if (mp_timer != nullptr)
 			{
-				t.join();
+				mp_timer->Cancel();
 			} // end if
-		} // end for t
+		} // end Destructor
 
-		m_vect_threads.clear();
-		m_vect_signals.clear();
+		void operator()(void)
+		{
+			std::shared_ptr<Timer_t> p_timer = std::move(mp_timer);
 
-		mu_li_nrunning = 0;
-	} // end method Stop
+			mp_pool->run_periodic(p_timer);
+		} // end operator()
+	}; // end struct Timer_Run_t
 
 
 	///<summary>
-	/// Removes all pending jobs from the queue and destroys them.
+	/// State of an <see cref="Executor"/>, protected by m_mtx_executors of its pool.
 	///</summary>
-	void Empty_Job_Queue(void)
+	struct Executor_t
 	{
-		Guard_t guard(m_mtx_tasks);
-		while (m_q_tasks.empty() == false)
+		const std::string m_str_name;              //! the name of the executor
+		const std::size_t mu_li_weight;            //! the number of jobs picked in a row once the executor's turn comes
+		const std::size_t mu_li_max_concurrency;   //! the maximum number of jobs executing at once, 0 if unlimited
+		std::size_t       mu_li_nrunning;          //! the number of jobs executing
+		std::size_t       mu_li_deficit;           //! the number of jobs the executor may still have picked in its current turn
+		Job_Queue_t       m_q_jobs;                //! the jobs waiting for execution
+
+		Executor_t(const std::string& k_str_name_, const std::size_t ku_li_WEIGHT_, const std::size_t ku_li_MAX_CONCURRENCY_, Slab_Arena* p_arena_)
+			: m_str_name(k_str_name_), mu_li_weight(ku_li_WEIGHT_), mu_li_max_concurrency(ku_li_MAX_CONCURRENCY_), mu_li_nrunning(0), mu_li_deficit(ku_li_WEIGHT_),
+			m_q_jobs(Arena_Allocator<Job_t>(p_arena_))
 		{
-			m_q_tasks.pop();
-		} // end while
-	} // end method Empty_Job_Queue
+		} // end Constructor
+
+		///<summary>
+		/// Returns the number of queued jobs that could be executed right away without exceeding the concurrency limit.
+		///</summary>
+		std::size_t N_Runnable(void) const noexcept
+		{
+			if (mu_li_max_concurrency == 0)
+			{
+				return m_q_jobs.size();
+			} // end if
+
+			return mu_li_nrunning < mu_li_max_concurrency ? std::min(m_q_jobs.size(), mu_li_max_concurrency - mu_li_nrunning) : 0;
+		} // end method N_Runnable
+	}; // end struct Executor_t
 
 
 	///<summary>
-	/// Blocks until all pending jobs have been completed.
+	/// Job executing the next job of one of the executors of a pool, see <see cref="run_executor_job"/>.
+	/// Tokens are interchangeable, there is one for every executor job that could be executed.
 	///</summary>
-	///<returns>
-	/// True on successful completion of all pending jobs.
-	/// False if no threads are running.
-	///</returns>
-	bool Synchronize(void) const noexcept
+	struct Executor_Run_t
 	{
-		if (mu_li_nrunning == 0)
+		BasicThreadPool* mp_pool; //! the pool of the executors, nullptr once executed or moved
+
+		explicit Executor_Run_t(BasicThreadPool* p_pool_) noexcept
+			: mp_pool(p_pool_)
 		{
-			std::cerr << "ThreadPool::Synchronize invoked with 0 running threads! Did you call Start_All?" << std::endl;
-			return false;
-		} // end if
+		} // end Constructor(1)
 
-		while (m_q_tasks.empty() == false)
+		Executor_Run_t(Executor_Run_t&& other_) noexcept
+			: mp_pool(std::exchange(other_.mp_pool, nullptr))
 		{
-			std::this_thread::yield();
-		} // end while
+		} // end Constructor(2)
 
-		// wait for all threads to complete their current work
-		for (auto& _signal : m_vect_signals)
+		// a discarded token leaves the jobs queued, they are discarded along with it by Empty_Job_Queue
+		~Executor_Run_t(void)
 		{
-			while (_signal == THREAD_SIGNALS::TP_WORKING)
+			if (mp_pool != nullptr)
 			{
-				std::this_thread::yield();
-			} // end while
-		} // end for
+				Guard_t guard(mp_pool->m_mtx_executors);
 
-		return true;
-	} // end method Synchronize
+				mp_pool->mu_li_executor_tokens--;
+			} // end if
+		} // end Destructor
+
+		void operator()(void)
+		{
+			std::exchange(mp_pool, nullptr)->run_executor_job();
+		} // end operator()
+	}; // end struct Executor_Run_t
 
 
 	///<summary>
-	/// Accessor for the number of threads running.
+	/// State of a <see cref="Strand"/>.
 	///</summary>
-	///<returns>The number of threads currently running.</returns>
-	std::size_t N_Threads_Running(void) const noexcept
+	struct Strand_t
 	{
-		return mu_li_nrunning;
-	} // end method N_Threads_Running
+		std::mutex        m_mtx;              //! mutex protecting the queue, the flag and the count
+		std::queue<Job_t> m_q_jobs;           //! the jobs waiting for execution, in order
+		bool              mb_scheduled;       //! whether or not the strand is in the queue of the pool or executing
+		std::size_t       mu_li_nscheduled;   //! the number of times the strand was scheduled, see add_strand_job
+		const bool        mb_sticky;          //! whether or not batches of jobs are executed on one thread
+
+		explicit Strand_t(const bool kb_STICKY_)
+			: mb_scheduled(false), mu_li_nscheduled(0), mb_sticky(kb_STICKY_)
+		{
+		} // end Constructor
+	}; // end struct Strand_t
 
 
 	///<summary>
-	/// Accessor for the number of jobs not completed.
+	/// Job executing the next jobs of a strand, see <see cref="run_strand"/>. A strand has at most one.
 	///</summary>
-	///<returns>The number of jobs that remain in the queue.</returns>
-	std::size_t N_Jobs_Remaining(void) const noexcept
+	struct Strand_Run_t
 	{
-		Guard_t guard(m_mtx_tasks);
+		BasicThreadPool*          mp_pool;   //! the pool of the strand
+		std::shared_ptr<Strand_t> mp_strand; //! the strand, nullptr once executed or moved
 
-		return m_q_tasks.size();
-	} // end method N_Jobs_Remaining
+		Strand_Run_t(BasicThreadPool* p_pool_, std::shared_ptr<Strand_t> p_strand_) noexcept
+			: mp_pool(p_pool_), mp_strand(std::move(p_strand_))
+		{
+		} // end Constructor(1)
 
+		Strand_Run_t(Strand_Run_t&& other_) noexcept = default;
 
-	///<summary>
-	/// Returns whether or not an exception pointer was queued for processing.
-	///</summary>
-	///<returns>True iff there are exceptions waiting for processing, otherwise false.</returns>
-	bool Has_Exceptions(void) const noexcept
-	{
-		Guard_t guard(m_mtx_exception);
+		// a discarded strand discards its jobs along with it, and can be added again
+		~Strand_Run_t(void)
+		{
+			if (mp_strand != nullptr)
+			{
+				std::queue<Job_t> q_discarded;
+				Lock_t lock(mp_strand->m_mtx);
 
-		return m_q_exception.empty() == false;
-	} // end method Has_Exceptions
+				q_discarded.swap(mp_strand->m_q_jobs);
+				mp_strand->mb_scheduled = false;
+				lock.unlock();
+			} // end if
+		} // end Destructor
+
+		void operator()(void)
+		{
+			std::shared_ptr<Strand_t> p_strand = std::move(mp_strand);
+
+			mp_pool->run_strand(p_strand);
+		} // end operator()
+	}; // end struct Strand_Run_t
 
 
 	///<summary>
-	/// Returns a list of all threads and their current states at the time of invocation.
+	/// Shared state of a <see cref="Future"/> and the promise of the job producing its result.
 	///</summary>
-	///<returns>A vector of all thread states.</returns>
-	std::vector<int> Thread_States(void) const
+	template <class T>
+	struct Future_State_t
 	{
-		Guard_t guard(m_mtx_signals);
+		// references are stored as reference wrappers, no result as a flag that is never read
+		using Value_t = std::conditional_t<std::is_void<T>::value, bool,
+			std::conditional_t<std::is_lvalue_reference<T>::value, std::reference_wrapper<std::remove_reference_t<T>>, T>>;
 
-		return std::vector<int>(m_vect_signals);
-	} // end method Thread_States
+		std::mutex              m_mtx;              //! mutex protecting the result and the continuation
+		std::condition_variable m_cv;               //! condition threads waiting for the result block on
+		std::atomic<bool>       ma_b_ready;         //! whether or not the result is available
+		std::optional<Value_t>  m_opt_value;        //! the result, if the job returned
+		std::exception_ptr      m_exptr;            //! the exception, if the job threw
+		Job_t                   m_job_continuation; //! the job to run once the result is available, empty if none
+		bool                    mb_dispatch;        //! whether the continuation is added to the pool or invoked inline
+		JOB_PRIORITIES          me_priority;        //! the priority the continuation is added with
+		BasicThreadPool*        mp_pool;            //! the pool executing the job and its continuations
+
+		explicit Future_State_t(BasicThreadPool* p_pool_)
+			: ma_b_ready(false), mb_dispatch(false), me_priority(JOB_PRIORITIES::TP_PRIORITY_NORMAL), mp_pool(p_pool_)
+		{
+		} // end Constructor
+
+		///<summary>
+		/// Stores the result and wakes all waiting threads, unless a result is available already.
+		///</summary>
+		template <class V>
+		void Set_Value(V&& value_)
+		{
+			Lock_t lock(m_mtx);
+
+			if (ma_b_ready.load(std::memory_order_relaxed) == false)
+			{
+				m_opt_value.emplace(std::forward<V>(value_));
+				complete(lock);
+			} // end if
+		} // end method Set_Value
+
+		///<summary>
+		/// Stores the exception and wakes all waiting threads, unless a result is available already.
+		///</summary>
+		void Set_Exception(std::exception_ptr exptr_)
+		{
+			Lock_t lock(m_mtx);
+
+			if (ma_b_ready.load(std::memory_order_relaxed) == false)
+			{
+				m_exptr = std::move(exptr_);
+				complete(lock);
+			} // end if
+		} // end method Set_Exception
+
+		///<summary>
+		/// Runs <paramref name="fn_job_"/> once the result is available, right away if it is available already.
+		///</summary>
+		///<param name="kb_DISPATCH_">Whether the job is added to the pool, or invoked by the thread providing the result.</param>
+		void On_Ready(Job_t&& fn_job_, const bool kb_DISPATCH_, const JOB_PRIORITIES ke_PRIORITY_)
+		{
+			Lock_t lock(m_mtx);
+
+			mb_dispatch = kb_DISPATCH_;
+			me_priority = ke_PRIORITY_;
+
+			if (ma_b_ready.load(std::memory_order_relaxed) == false)
+			{
+				m_job_continuation = std::move(fn_job_);
+				return;
+			} // end if
+
+			lock.unlock();
+			dispatch(fn_job_);
+		} // end method On_Ready
+
+		///<summary>
+		/// Blocks until the result is available.
+		///</summary>
+		void Wait(void)
+		{
+			Lock_t lock(m_mtx);
+
+			m_cv.wait(lock, [this](void) { return ma_b_ready.load(std::memory_order_relaxed); });
+		} // end method Wait
+
+		///<summary>
+		/// Blocks until the result is available or <paramref name="k_deadline_"/> has passed.
+		///</summary>
+		///<returns>True if the result is available.</returns>
+		template <class Clock, class Duration>
+		bool Wait_Until(const std::chrono::time_point<Clock, Duration>& k_deadline_)
+		{
+			Lock_t lock(m_mtx);
+
+			return m_cv.wait_until(lock, k_deadline_, [this](void) { return ma_b_ready.load(std::memory_order_relaxed); });
+		} // end method Wait_Until
+
+		///<summary>
+		/// Moves the result out of the state, or rethrows the exception of the job. The result must be available.
+		///</summary>
+		T Take(void)
+		{
+			if (m_exptr)
+			{
+				std::rethrow_exception(m_exptr);
+			} // end if
+
+			if constexpr (std::is_lvalue_reference<T>::value == true)
+			{
+				return m_opt_value->get();
+			} // end if
+			else if constexpr (std::is_void<T>::value == false)
+			{
+				return std::move(*m_opt_value);
+			} // end if
+		} // end method Take
+
+	private:
+		///<summary>
+		/// Marks the result as available, wakes all waiting threads and runs the continuation. Must be called while holding <paramref name="lock_"/>.
+		///</summary>
+		void complete(Lock_t& lock_)
+		{
+			Job_t job = std::move(m_job_continuation);
+
+			ma_b_ready.store(true, std::memory_order_release);
+			m_cv.notify_all();
+			lock_.unlock();
+
+			dispatch(job);
+		} // end method complete
+
+		///<summary>
+		/// Adds <paramref name="fn_job_"/> to the pool or invokes it, as given by <see cref="mb_dispatch"/>.
+		///</summary>
+		void dispatch(Job_t& fn_job_)
+		{
+			if (!fn_job_)
+			{
+				return;
+			} // end if
+
+			if (mb_dispatch == true)
+			{
+				mp_pool->push_forced(fn_job_, me_priority);
+			} // end if
+			else
+			{
+				fn_job_();
+			} // end else
+		} // end method dispatch
+	}; // end struct Future_State_t
 
 
 	///<summary>
-	/// Accessor for the last exception that has occurred, exceptions are returned in order of occurrence.
+	/// Standard allocator drawing from the arena of the calling thread, see <see cref="allocate"/>.
+	/// Memory may be deallocated on any thread, even after the pool was destroyed.
 	///</summary>
-	///<returns>An exception pointer to the next exception, or a nullptr if no exceptions are queued.</returns>
-	std::exception_ptr Last_Exception(void)
+	template <class T>
+	struct Allocator_t
 	{
-		Guard_t guard(m_mtx_exception);
-		std::exception_ptr exptr_exception;
+		using value_type = T;
+
+		BasicThreadPool* mp_pool; //! the pool whose arenas memory is drawn from
 
-		if (m_q_exception.empty() == false)
+		explicit Allocator_t(BasicThreadPool* p_pool_) noexcept
+			: mp_pool(p_pool_)
 		{
-			exptr_exception = m_q_exception.front();
-			m_q_exception.pop();
-		} // end if
+		} // end Constructor(1)
 
-		return exptr_exception;
-	} // end method Last_Exception
+		template <class U>
+		Allocator_t(const Allocator_t<U>& k_other_) noexcept
+			: mp_pool(k_other_.mp_pool)
+		{
+		} // end Constructor(2)
+
+		T* allocate(const std::size_t ku_li_N_)
+		{
+			return static_cast<T*>(mp_pool->allocate(ku_li_N_ * sizeof(T)));
+		} // end method allocate
+
+		void deallocate(T* p_, const std::size_t ku_li_N_) noexcept
+		{
+			Slab_Arena::Free(p_, ku_li_N_ * sizeof(T));
+		} // end method deallocate
+
+		// any arena accepts memory of any other arena
+		template <class U>
+		bool operator==(const Allocator_t<U>&) const noexcept
+		{
+			return true;
+		} // end operator==
+
+		template <class U>
+		bool operator!=(const Allocator_t<U>&) const noexcept
+		{
+			return false;
+		} // end operator!=
+	}; // end struct Allocator_t
 
 
-protected:
 	///<summary>
-	/// Thread main function. Threads will idle until work is available 
-	/// and they have not received a sigterm from the main thread.
+	/// Producing side of a <see cref="Future"/>, held by the job. A promise destroyed before providing 
+	/// a result stores a std::future_error with broken_promise.
 	///</summary>
-	///<param name="ku_li_MY_ID_">The id of this thread within the thread pool.</param>
-	void idle_thread(const std::size_t ku_li_MY_ID_)
+	template <class T>
+	struct Promise_t
 	{
-		auto b_run = true;
+		std::shared_ptr<Future_State_t<T>> mp_state; //! the shared state, nullptr once moved
 
-		while (b_run == true)
+		explicit Promise_t(BasicThreadPool* p_pool_)
+			: mp_state(std::allocate_shared<Future_State_t<T>>(Allocator_t<Future_State_t<T>>(p_pool_), p_pool_))
+		{
+		} // end Constructor(1)
+
+		Promise_t(Promise_t&& other_) noexcept = default;
+
+		~Promise_t(void)
+		{
+			if (mp_state != nullptr && mp_state->ma_b_ready.load(std::memory_order_acquire) == false)
+			{
+				mp_state->Set_Exception(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+			} // end if
+		} // end Destructor
+
+		///<summary>
+		/// Returns a future referring to the shared state of this promise.
+		///</summary>
+		Future<T> Get_Future(void) const
 		{
-			auto fn_job = get_work(ku_li_MY_ID_);
+			return Future<T>(mp_state);
+		} // end method Get_Future
 
+		///<summary>
+		/// Invokes <paramref name="fn_"/> and stores its result, or the exception it threw.
+		///</summary>
+		template <class F>
+		void Run(F&& fn_)
+		{
 			try
 			{
-				fn_job();
+				if constexpr (std::is_void<T>::value == true)
+				{
+					fn_();
+					mp_state->Set_Value(true);
+				} // end if
+				else
+				{
+					mp_state->Set_Value(fn_());
+				} // end else
 			} // end try
-			catch (const std::exception& e)
+			catch (...)
 			{
-				Guard_t guard(m_mtx_exception);
-				std::cerr << "[Thread " << ku_li_MY_ID_ << "]: An exception occurred while executing a job." << std::endl;
-				std::cerr << e.what() << std::endl;
-			}
-			catch (...) // catch any kind of exception and alert the user
-			{
-				Guard_t guard(m_mtx_exception);
-				std::cerr << "[Thread " << ku_li_MY_ID_ << "]: An exception occurred while executing a job." << std::endl;
-				m_q_exception.push(std::current_exception());
+				mp_state->Set_Exception(std::current_exception());
 			} // end catch all
+		} // end method Run
+	}; // end struct Promise_t
+
+#ifdef __cpp_lib_coroutine
+
+	///<summary>
+	/// Job resuming a coroutine suspended by a <see cref="Schedule_Awaiter"/>. A job that is destroyed 
+	/// without being executed still resumes the coroutine, which then throws from the await.
+	///</summary>
+	struct Resume_t
+	{
+		Schedule_Awaiter*       mp_awaiter; //! the awaiter the coroutine is suspended on
+		std::coroutine_handle<> m_handle;   //! the suspended coroutine, nullptr once resumed or moved
+
+		Resume_t(Schedule_Awaiter* p_awaiter_, std::coroutine_handle<> handle_) noexcept
+			: mp_awaiter(p_awaiter_), m_handle(handle_)
+		{
+		} // end Constructor(1)
 
-			switch (m_vect_signals.at(ku_li_MY_ID_))
+		Resume_t(Resume_t&& other_) noexcept
+			: mp_awaiter(other_.mp_awaiter), m_handle(std::exchange(other_.m_handle, nullptr))
+		{
+		} // end Constructor(2)
+
+		~Resume_t(void)
+		{
+			if (m_handle)
 			{
-			case THREAD_SIGNALS::TP_SIGTERM:
-				b_run = false;
-				break;
-			default:
-				break;
-			} // end switch
-		} // end while
+				mp_awaiter->mb_discarded = true;
+				std::exchange(m_handle, nullptr).resume();
+			} // end if
+		} // end Destructor
 
+		void operator()(void)
 		{
-			Guard_t guard(m_mtx_signals);
-			m_vect_signals.at(ku_li_MY_ID_) = THREAD_SIGNALS::TP_TERMINATING;
-		}
-	} // end idle_thread
+			std::exchange(m_handle, nullptr).resume();
+		} // end operator()
+	}; // end struct Resume_t
 
 
 	///<summary>
-	/// Removes and returns the next job from the queue and sets the calling thread's status. 
-	/// If no jobs are queued, the job defaults to yield. 
+	/// Coroutine type of coroutines that run eagerly and destroy themselves once they complete.
 	///</summary>
-	///<param name="ku_li_MY_ID_">The id of the calling thread within the thread pool.</param>
-	///<returns>A callable function object that the thread should execute.</returns>
-	Job_t get_work(const std::size_t ku_li_MY_ID_)
+	struct Detached_t
 	{
-		Guard_t guard(m_mtx_tasks);
+		struct promise_type
+		{
+			Detached_t get_return_object(void) const noexcept
+			{
+				return {};
+			} // end method get_return_object
 
-		Job_t job;
+			std::suspend_never initial_suspend(void) const noexcept
+			{
+				return {};
+			} // end method initial_suspend
 
-		if (m_q_tasks.empty() == false)
-		{
-			job = std::move(m_q_tasks.front());
-			m_q_tasks.pop();
+			std::suspend_never final_suspend(void) const noexcept
+			{
+				return {};
+			} // end method final_suspend
 
-			Guard_t guard(m_mtx_signals);
-			if (m_vect_signals[ku_li_MY_ID_] != THREAD_SIGNALS::TP_SIGTERM)
+			void return_void(void) const noexcept
 			{
-				m_vect_signals[ku_li_MY_ID_] = THREAD_SIGNALS::TP_WORKING;
-			} // end if
-		} // end if
-		else
-		{
-			job = std::this_thread::yield;
+			} // end method return_void
 
-			Guard_t guard(m_mtx_signals);
-			if (m_vect_signals[ku_li_MY_ID_] != THREAD_SIGNALS::TP_SIGTERM)
+			// the coroutines catch everything themselves
+			void unhandled_exception(void) const noexcept
 			{
-				m_vect_signals[ku_li_MY_ID_] = THREAD_SIGNALS::TP_IDLE;
-			} // end if
-		} // end else
+				std::terminate();
+			} // end method unhandled_exception
+		}; // end struct promise_type
+	}; // end struct Detached_t
 
-		return job;
-	} // end method get_work
+#endif
 
+	inline static thread_local BasicThreadPool* ts_p_pool   = nullptr; //! the pool the calling thread belongs to
+	inline static thread_local Worker_t*        ts_p_worker = nullptr; //! the state of the calling thread
 
-private:
 	std::size_t mu_li_nthreads;                          //! the number of threads
-	std::size_t mu_li_nrunning;                          //! the number of running threads
+	std::atomic<std::size_t> ma_u_li_nrunning;           //! the number of running threads
+	std::size_t mu_li_min_threads;                       //! elastic mode: the number of threads kept running
+	std::size_t mu_li_max_threads;                       //! elastic mode: the maximum number of threads, 0 if not elastic
+	std::size_t mu_li_spawn_depth;                       //! elastic mode: the number of waiting jobs that adds threads at once
+	std::size_t mu_li_max_compensating;                  //! the maximum number of threads started for threads in blocking regions
+	std::chrono::milliseconds m_dur_spawn_wait;          //! elastic mode: the interval between checks of the pool
+	std::chrono::milliseconds m_dur_idle_timeout;        //! elastic mode: the time after which idle threads are retired
+	SHUTDOWN_POLICIES me_shutdown;                       //! how the destructor shuts the pool down
+	std::chrono::milliseconds m_dur_shutdown_timeout;    //! the time pending jobs are given with TP_SHUTDOWN_DEADLINE
+	std::size_t mu_li_spin_count;                        //! the number of times idle threads poll before parking
+	std::size_t mu_li_capacity;                          //! the maximum number of jobs in the locked queue, or in the ring of every priority
+	std::size_t mu_li_starvation_limit;                  //! every n-th job a thread takes is looked for at a lower priority first
+	SCHEDULING_MODES me_scheduling;                      //! how jobs are distributed among threads
+	QUEUE_BACKENDS   me_queue;                           //! the data structure backing the shared queue
+	AFFINITY_MODES   me_affinity;                        //! how threads are pinned to CPUs
              
 	std::vector<std::thread> m_vect_threads;             //! container storing thread objects
-	std::vector<int>         m_vect_signals;             //! signal vector to communicate with threads
+	std::thread              m_thread_manager;           //! the thread adjusting the number of threads in elastic mode and starting compensating threads
+	bool                     mb_stop_manager;            //! whether or not the manager thread should terminate
+	bool                     mb_compensate;              //! whether or not a thread entered a blocking region since the manager thread last checked, protected by m_mtx_manager
+	std::thread              m_thread_timer;             //! the thread adding scheduled jobs, started with the first scheduled job
+
+	Slab_Arena::Resource_t*  mp_memory_resource;         //! the upstream of all arenas of the pool
+	alignas(M_CACHE_LINE_SIZE) Slab_Arena m_arena_external; //! the arena jobs and shared states created outside the pool are allocated from
+	std::mutex               m_mtx_arena;                //! mutex serializing allocations from the external arena
+
+	alignas(M_CACHE_LINE_SIZE) std::mutex m_mtx_executors; //! mutex protecting the executors, their queues and their arena
+	Slab_Arena               m_arena_executors;          //! the arena the queues of the executors allocate from
+	std::vector<std::shared_ptr<Executor_t>> m_vect_executors; //! all executors ever created, in round robin order
+	std::size_t              mu_li_executor_cursor;      //! the executor whose turn it is
+	std::size_t              mu_li_executor_runnable;    //! the number of executor jobs that could be executed right away
+	std::size_t              mu_li_executor_tokens;      //! the number of tokens that are queued or about to pick a job
+
+	std::once_flag                         m_once_strands;       //! flag creating the keyed strands on first use
+	std::vector<std::shared_ptr<Strand_t>> m_vect_keyed_strands; //! the strands keys are hashed onto
+
+	alignas(M_CACHE_LINE_SIZE) std::vector<std::unique_ptr<Worker_t>> m_vect_workers; //! state of all threads ever started
+	std::vector<std::unique_ptr<Worker_Table_t>> m_vect_tables;  //! all worker tables ever published
+	std::atomic<const Worker_Table_t*>           ma_p_workers;   //! the current worker table
+	std::vector<CPU_Topology::CPU_Info>          m_vect_placement; //! the CPUs threads are pinned to in order, empty if threads are not pinned
+	std::vector<std::unique_ptr<Node_Queue_t>>   m_vect_nodes;   //! the shared queues, one per NUMA node with node queues or exactly one
              
-	mutable std::mutex m_mtx_tasks;                      //! mutex protecting the task queue
-	mutable std::mutex m_mtx_signals;                    //! mutex protecting the signals vector
-	mutable std::mutex m_mtx_exception;                  //! mutex protecting the exception queue
+	mutable std::mutex m_mtx_threads;                    //! mutex protecting the running threads, not used while dispatching jobs
+	std::mutex         m_mtx_resize;                     //! mutex serializing changes to the number of running threads
+	std::mutex         m_mtx_manager;                    //! mutex used by the manager thread to wait between checks
+	std::mutex         m_mtx_timers;                     //! mutex protecting the timer wheel and the timer thread
+	mutable std::mutex m_mtx_exception;                  //! mutex serializing readers of the exception queue, threads adding exceptions don't take it
+	std::condition_variable  m_cv_manager;               //! condition the manager thread waits on between checks
+	std::condition_variable  m_cv_timers;                //! condition the timer thread sleeps on until the next tick of interest
+
+	// the state written while jobs are dispatched is grouped by the threads writing it, and every group starts on a line of 
+	// its own, above as well, so producers, parking threads and waiting threads don't invalidate each other's lines, 
+	// nor the lines of the settings and the worker table, which every thread reads
+	alignas(M_CACHE_LINE_SIZE) std::atomic<std::size_t> ma_u_li_nsubmitted; //! the number of jobs submitted by threads outside the pool
+	std::atomic<std::size_t> ma_u_li_next_node;          //! the node the next job from outside the pool is added to
+
+	alignas(M_CACHE_LINE_SIZE) std::atomic<std::size_t> ma_u_li_ncompleted; //! the number of jobs completed by threads outside the pool
+	std::atomic<std::size_t> ma_u_li_ndiscarded;         //! the number of jobs discarded by Empty_Job_Queue
+
+	alignas(M_CACHE_LINE_SIZE) std::atomic<std::size_t> ma_u_li_nparked; //! the number of parked threads
+	std::mutex               m_mtx_park;                 //! mutex used by idle threads to park
+	std::condition_variable  m_cv_park;                  //! condition parked threads wait on
+
+	alignas(M_CACHE_LINE_SIZE) std::atomic<std::size_t> ma_u_li_nblocked; //! the number of producers waiting for room in the queue
+	std::mutex               m_mtx_space;                //! mutex used by producers to wait for room in the queue
+	std::condition_variable  m_cv_space;                 //! condition blocked producers wait on
+
+	alignas(M_CACHE_LINE_SIZE) mutable std::atomic<std::size_t> ma_u_li_nsyncing; //! the number of threads waiting in Synchronize
+	mutable std::mutex       m_mtx_sync;                 //! mutex used by Synchronize to wait for pending jobs
+	mutable std::condition_variable m_cv_sync;           //! condition threads in Synchronize wait on
+
+	alignas(M_CACHE_LINE_SIZE) std::atomic<std::size_t> ma_u_li_nblocking; //! the number of threads of the pool inside blocking regions
+	std::atomic<std::size_t> ma_u_li_ncompensating;      //! the number of threads started to stand in for blocked threads, written while holding m_mtx_resize
+	std::mutex               m_mtx_standby;              //! mutex used by compensating threads that are not needed to stand by
+	std::condition_variable  m_cv_standby;               //! condition compensating threads stand by on
+
+	alignas(M_CACHE_LINE_SIZE) Timer_Wheel<std::shared_ptr<Timer_t>> m_wheel_timers; //! the scheduled jobs by the tick they are due at
+	const std::chrono::steady_clock::time_point m_tp_timer_epoch; //! the point in time of tick 0
+	std::uint64_t                         mu_li_timer_wakeup;   //! the tick the timer thread sleeps until, 0 while it is awake
+
+	MPSC_Queue<std::exception_ptr, M_CACHE_LINE_SIZE> m_q_exception; //! queue storing exceptions that occurred during execution of past jobs
+	std::function<void(std::exception_ptr)> m_fn_exception_handler; //! receives exceptions thrown by jobs instead of the queue, if set
+	std::function<void(std::size_t)>      m_fn_on_thread_start;  //! invoked by every thread started from now on before its first job, protected by m_mtx_threads
+	std::function<void(std::size_t)>      m_fn_on_thread_stop;   //! invoked by every thread started from now on after its last job, protected by m_mtx_threads
+#if __has_cpp_attribute(no_unique_address)
+	[[no_unique_address]] Metrics_Storage_t m_metrics_external{ false }; //! the counters of threads outside the pool, empty without metrics
+#else
+	Metrics_Storage_t                     m_metrics_external{ false }; //! the counters of threads outside the pool, empty without metrics
+#endif
+#ifdef THREAD_POOL_ENABLE_TRACING
+	alignas(M_CACHE_LINE_SIZE) std::atomic<bool> ma_b_tracing{ false }; //! whether or not events are recorded, read by every thread adding or executing jobs
+	alignas(M_CACHE_LINE_SIZE) std::atomic<std::uint64_t> ma_u_li_trace_ids{ 0 }; //! the last id assigned to a job while tracing
+	std::mutex                            m_mtx_trace;                 //! mutex serializing threads outside the pool recording events
+	Trace_Buffer                          m_trace_external{ M_TRACE_BUFFER_SIZE }; //! the events recorded by threads outside the pool
+#endif
+
+}; // end class BasicThreadPool
 
-	std::queue<Job_t> m_q_tasks;     //! queue storing tasks waiting for execution
-	std::queue<std::exception_ptr>        m_q_exception; //! queue storing exceptions that occurred during execution of past jobs
 
-}; // end class ThreadPool
+using ThreadPool = BasicThreadPool<>;
 
 #endif
@@ -0,0 +1,207 @@
+#pragma once
+
+#ifndef __TIMER_WHEEL_HPP
+#define __TIMER_WHEEL_HPP
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <vector>       // vector
+#include <utility>      // move
+
+///<summary>
+/// Hierarchical timer wheel storing elements until a tick is reached, as described by Varghese and Lauck.
+///</summary>
+///<remarks>
+/// Level k of the wheel has M_N_SLOTS slots covering M_N_SLOTS^k ticks each. Elements are inserted
+/// into the lowest level whose range covers their expiry, in O(1), and moved down one level each time
+/// the level above the one they are in completes a slot. Elements further away than the highest level
+/// covers are parked in its last slot and re-inserted when that slot is reached.
+/// The wheel is not synchronized, callers serialize all calls themselves.
+///</remarks>
+template <class T>
+class Timer_Wheel
+{
+public:
+	static constexpr std::size_t M_SLOT_BITS = 6;
+	static constexpr std::size_t M_N_SLOTS = std::size_t(1) << M_SLOT_BITS;
+	static constexpr std::size_t M_N_LEVELS = 4;
+
+private:
+	///<summary>
+	/// An element and the tick it expires at.
+	///</summary>
+	struct Entry
+	{
+		std::uint64_t u_li_expiry; //! the tick the element expires at
+		T             item;        //! the element
+	}; // end struct Entry
+
+	using Slot_t = std::vector<Entry>;
+
+public:
+	///<summary>
+	/// Initializes an empty wheel at tick 0.
+	///</summary>
+	Timer_Wheel(void)
+		: mu_li_now(0), mu_li_size(0)
+	{
+	} // end Constructor
+
+
+	///<summary>
+	/// Adds <paramref name="item_"/> to expire at tick <paramref name="ku_li_EXPIRY_"/>.
+	///</summary>
+	///<param name="ku_li_EXPIRY_">The tick the element expires at, ticks that have passed expire on the next tick.</param>
+	///<param name="item_">The element to add.</param>
+	void Insert(const std::uint64_t ku_li_EXPIRY_, T item_)
+	{
+		insert(Entry{ ku_li_EXPIRY_ > mu_li_now ? ku_li_EXPIRY_ : mu_li_now + 1, std::move(item_) });
+		mu_li_size++;
+	} // end method Insert
+
+
+	///<summary>
+	/// Advances the wheel to tick <paramref name="ku_li_NOW_"/> and moves all elements that expired on the way to <paramref name="vect_due_"/>.
+	///</summary>
+	///<param name="ku_li_NOW_">The current tick, nothing happens if it is not after the tick of the wheel.</param>
+	///<param name="vect_due_">Receives the expired elements, in order of expiry.</param>
+	void Advance(const std::uint64_t ku_li_NOW_, std::vector<T>& vect_due_)
+	{
+		while (mu_li_now < ku_li_NOW_ && mu_li_size != 0)
+		{
+			mu_li_now++;
+
+			// a completed slot of a level moves the next slot of the level above down
+			for (std::size_t u_li_level = 1; u_li_level < M_N_LEVELS && index(mu_li_now, u_li_level - 1) == 0; u_li_level++)
+			{
+				Slot_t slot_cascade = std::move(m_arr_slots[u_li_level][index(mu_li_now, u_li_level)]);
+
+				m_arr_slots[u_li_level][index(mu_li_now, u_li_level)].clear();
+
+				for (auto& entry : slot_cascade)
+				{
+					insert(std::move(entry));
+				} // end for entry
+			} // end for u_li_level
+
+			Slot_t& slot_due = m_arr_slots[0][index(mu_li_now, 0)];
+
+			for (auto& entry : slot_due)
+			{
+				vect_due_.push_back(std::move(entry.item));
+			} // end for entry
+
+			mu_li_size -= slot_due.size();
+			slot_due.clear();
+		} // end while
+
+		// without elements, no slot has to be visited on the way
+		if (mu_li_now < ku_li_NOW_)
+		{
+			mu_li_now = ku_li_NOW_;
+		} // end if
+	} // end method Advance
+
+
+	///<summary>
+	/// Returns the next tick the wheel has to be advanced to, either for an element to expire
+	/// or for elements of a higher level to be moved down.
+	///</summary>
+	///<returns>The next tick of interest, undefined if the wheel is empty.</returns>
+	std::uint64_t Next_Tick(void) const noexcept
+	{
+		const std::uint64_t ku_li_WRAP = (mu_li_now | (M_N_SLOTS - 1)) + 1;
+
+		for (std::uint64_t u_li_tick = mu_li_now + 1; u_li_tick < ku_li_WRAP; u_li_tick++)
+		{
+			if (m_arr_slots[0][index(u_li_tick, 0)].empty() == false)
+			{
+				return u_li_tick;
+			} // end if
+		} // end for u_li_tick
+
+		return ku_li_WRAP;
+	} // end method Next_Tick
+
+
+	///<summary>
+	/// Removes all elements from the wheel.
+	///</summary>
+	///<param name="vect_out_">Receives the removed elements.</param>
+	void Clear(std::vector<T>& vect_out_)
+	{
+		for (auto& arr_level : m_arr_slots)
+		{
+			for (auto& slot : arr_level)
+			{
+				for (auto& entry : slot)
+				{
+					vect_out_.push_back(std::move(entry.item));
+				} // end for entry
+
+				slot.clear();
+			} // end for slot
+		} // end for arr_level
+
+		mu_li_size = 0;
+	} // end method Clear
+
+
+	///<summary>
+	/// Accessor for the tick the wheel was last advanced to.
+	///</summary>
+	std::uint64_t Now(void) const noexcept
+	{
+		return mu_li_now;
+	} // end method Now
+
+
+	///<summary>
+	/// Returns whether or not the wheel holds any elements.
+	///</summary>
+	bool Empty(void) const noexcept
+	{
+		return mu_li_size == 0;
+	} // end method Empty
+
+
+private:
+	///<summary>
+	/// Returns the slot of level <paramref name="ku_li_LEVEL_"/> covering tick <paramref name="ku_li_TICK_"/>.
+	///</summary>
+	static std::size_t index(const std::uint64_t ku_li_TICK_, const std::size_t ku_li_LEVEL_) noexcept
+	{
+		return static_cast<std::size_t>(ku_li_TICK_ >> (ku_li_LEVEL_ * M_SLOT_BITS)) & (M_N_SLOTS - 1);
+	} // end method index
+
+
+	///<summary>
+	/// Adds <paramref name="entry_"/> to the lowest level covering its expiry, without counting it.
+	///</summary>
+	void insert(Entry&& entry_)
+	{
+		const std::uint64_t ku_li_DELTA = entry_.u_li_expiry - mu_li_now;
+
+		for (std::size_t u_li_level = 0; u_li_level < M_N_LEVELS; u_li_level++)
+		{
+			if (ku_li_DELTA < (std::uint64_t(1) << ((u_li_level + 1) * M_SLOT_BITS)))
+			{
+				m_arr_slots[u_li_level][index(entry_.u_li_expiry, u_li_level)].push_back(std::move(entry_));
+				return;
+			} // end if
+		} // end for u_li_level
+
+		// too far away, parked in the last slot the highest level reaches and re-inserted from there
+		const std::size_t ku_li_TOP = M_N_LEVELS - 1;
+
+		m_arr_slots[ku_li_TOP][(index(mu_li_now, ku_li_TOP) + M_N_SLOTS - 1) & (M_N_SLOTS - 1)].push_back(std::move(entry_));
+	} // end method insert
+
+
+	Slot_t        m_arr_slots[M_N_LEVELS][M_N_SLOTS]; //! the slots of every level
+	std::uint64_t mu_li_now;                          //! the tick the wheel was last advanced to
+	std::size_t   mu_li_size;                         //! the number of elements in the wheel
+
+}; // end class Timer_Wheel
+
+#endif
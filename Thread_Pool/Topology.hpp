@@ -0,0 +1,304 @@
+#pragma once
+
+#ifndef __TOPOLOGY_HPP
+#define __TOPOLOGY_HPP
+
+#include <cstddef>      // size_t
+#include <thread>       // hardware_concurrency
+#include <vector>       // vector
+#include <string>       // string, stoul, to_string, getline
+#include <fstream>      // ifstream
+#include <algorithm>    // max
+#include <exception>    // exception
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>    // SetThreadAffinityMask, GetNumaHighestNodeNumber, GetNumaNodeProcessorMask
+#elif defined(__linux__)
+#include <pthread.h>    // pthread_setaffinity_np
+#include <sched.h>      // cpu_set_t, sched_getaffinity
+#endif
+
+///<summary>
+/// The logical CPUs the calling process may run on, and the NUMA node each of them belongs to.
+///</summary>
+///<remarks>
+/// On Linux, the nodes are read from sysfs and the CPUs are limited to the affinity mask of the process.
+/// On Windows, only the first processor group is considered. Elsewhere, or if detection fails,
+/// all hardware threads are reported as belonging to node 0.
+///</remarks>
+class CPU_Topology
+{
+public:
+	///<summary>
+	/// A logical CPU.
+	///</summary>
+	struct CPU_Info
+	{
+		std::size_t u_li_cpu;  //! the id of the CPU as used by the operating system
+		std::size_t u_li_node; //! the index of the NUMA node of the CPU, counting from 0 without gaps
+	}; // end struct CPU_Info
+
+
+	///<summary>
+	/// Detects the topology of the machine the calling process runs on.
+	///</summary>
+	CPU_Topology(void)
+		: mu_li_nnodes(0)
+	{
+		detect();
+
+		if (m_vect_cpus.empty() == true)
+		{
+			const std::size_t ku_li_NCPUS = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+			for (std::size_t i = 0; i < ku_li_NCPUS; i++)
+			{
+				m_vect_cpus.push_back(CPU_Info{ i, 0 });
+			} // end for i
+		} // end if
+
+		for (const auto& k_cpu : m_vect_cpus)
+		{
+			mu_li_nnodes = std::max(mu_li_nnodes, k_cpu.u_li_node + 1);
+		} // end for k_cpu
+	} // end Constructor
+
+
+	///<summary>
+	/// Accessor for all usable CPUs, ordered by node and then by id.
+	///</summary>
+	///<returns>The usable CPUs.</returns>
+	const std::vector<CPU_Info>& CPUs(void) const noexcept
+	{
+		return m_vect_cpus;
+	} // end method CPUs
+
+
+	///<summary>
+	/// Accessor for the number of NUMA nodes that have usable CPUs.
+	///</summary>
+	///<returns>The number of nodes, at least 1.</returns>
+	std::size_t N_Nodes(void) const noexcept
+	{
+		return mu_li_nnodes;
+	} // end method N_Nodes
+
+
+	///<summary>
+	/// Returns the usable CPUs ordered such that consecutive CPUs are on different nodes where possible,
+	/// i.e. the first CPU of every node, then the second CPU of every node, and so on.
+	///</summary>
+	///<returns>The usable CPUs, interleaved across nodes.</returns>
+	std::vector<CPU_Info> Scattered(void) const
+	{
+		std::vector<std::vector<CPU_Info>> vect_by_node(mu_li_nnodes);
+		std::vector<CPU_Info> vect_out;
+
+		for (const auto& k_cpu : m_vect_cpus)
+		{
+			vect_by_node[k_cpu.u_li_node].push_back(k_cpu);
+		} // end for k_cpu
+
+		for (std::size_t i = 0; vect_out.size() < m_vect_cpus.size(); i++)
+		{
+			for (const auto& k_node : vect_by_node)
+			{
+				if (i < k_node.size())
+				{
+					vect_out.push_back(k_node[i]);
+				} // end if
+			} // end for k_node
+		} // end for i
+
+		return vect_out;
+	} // end method Scattered
+
+
+	///<summary>
+	/// Returns the node of the CPU with id <paramref name="ku_li_CPU_"/>.
+	///</summary>
+	///<param name="ku_li_CPU_">The id of the CPU as used by the operating system.</param>
+	///<returns>The index of the node, 0 if the CPU is unknown.</returns>
+	std::size_t Node_Of(const std::size_t ku_li_CPU_) const noexcept
+	{
+		for (const auto& k_cpu : m_vect_cpus)
+		{
+			if (k_cpu.u_li_cpu == ku_li_CPU_)
+			{
+				return k_cpu.u_li_node;
+			} // end if
+		} // end for k_cpu
+
+		return 0;
+	} // end method Node_Of
+
+
+	///<summary>
+	/// Restricts the calling thread to run on the CPU with id <paramref name="ku_li_CPU_"/> only.
+	///</summary>
+	///<param name="ku_li_CPU_">The id of the CPU as used by the operating system.</param>
+	///<returns>True on success, false if the CPU is not available or pinning is not supported.</returns>
+	static bool Pin_Current_Thread(const std::size_t ku_li_CPU_) noexcept
+	{
+#if defined(_WIN32)
+		if (ku_li_CPU_ >= sizeof(DWORD_PTR) * 8)
+		{
+			return false;
+		} // end if
+
+		return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << ku_li_CPU_) != 0;
+#elif defined(__linux__)
+		cpu_set_t set_cpus;
+
+		if (ku_li_CPU_ >= CPU_SETSIZE)
+		{
+			return false;
+		} // end if
+
+		CPU_ZERO(&set_cpus);
+		CPU_SET(ku_li_CPU_, &set_cpus);
+
+		return pthread_setaffinity_np(pthread_self(), sizeof(set_cpus), &set_cpus) == 0;
+#else
+		(void)ku_li_CPU_;
+
+		return false;
+#endif
+	} // end method Pin_Current_Thread
+
+
+private:
+	///<summary>
+	/// Fills <see cref="m_vect_cpus"/> using the interfaces of the operating system, leaves it empty on failure.
+	///</summary>
+	void detect(void)
+	{
+#if defined(_WIN32)
+		ULONG u_highest = 0;
+		std::size_t u_li_nnodes = 0;
+
+		if (GetNumaHighestNodeNumber(&u_highest) == 0)
+		{
+			return;
+		} // end if
+
+		for (ULONG u_node = 0; u_node <= u_highest; u_node++)
+		{
+			ULONGLONG u_mask = 0;
+			bool b_used = false;
+
+			if (GetNumaNodeProcessorMask(static_cast<UCHAR>(u_node), &u_mask) == 0)
+			{
+				continue;
+			} // end if
+
+			for (std::size_t i = 0; i < sizeof(u_mask) * 8; i++)
+			{
+				if ((u_mask >> i) & 1)
+				{
+					m_vect_cpus.push_back(CPU_Info{ i, u_li_nnodes });
+					b_used = true;
+				} // end if
+			} // end for i
+
+			u_li_nnodes += b_used ? 1 : 0;
+		} // end for u_node
+#elif defined(__linux__)
+		cpu_set_t set_allowed;
+		std::vector<std::size_t> vect_nodes;
+		std::size_t u_li_nnodes = 0;
+
+		CPU_ZERO(&set_allowed);
+
+		if (sched_getaffinity(0, sizeof(set_allowed), &set_allowed) != 0 ||
+			parse_list(read_line("/sys/devices/system/node/online"), vect_nodes) == false)
+		{
+			return;
+		} // end if
+
+		for (const auto ku_li_NODE : vect_nodes)
+		{
+			std::vector<std::size_t> vect_node_cpus;
+			bool b_used = false;
+
+			if (parse_list(read_line("/sys/devices/system/node/node" + std::to_string(ku_li_NODE) + "/cpulist"), vect_node_cpus) == false)
+			{
+				continue;
+			} // end if
+
+			for (const auto ku_li_CPU : vect_node_cpus)
+			{
+				if (ku_li_CPU < CPU_SETSIZE && CPU_ISSET(ku_li_CPU, &set_allowed))
+				{
+					m_vect_cpus.push_back(CPU_Info{ ku_li_CPU, u_li_nnodes });
+					b_used = true;
+				} // end if
+			} // end for ku_li_CPU
+
+			u_li_nnodes += b_used ? 1 : 0;
+		} // end for ku_li_NODE
+#endif
+	} // end method detect
+
+
+	///<summary>
+	/// Reads the first line of the file at <paramref name="k_str_PATH_"/>.
+	///</summary>
+	///<returns>The first line, or an empty string if the file cannot be read.</returns>
+	static std::string read_line(const std::string& k_str_PATH_)
+	{
+		std::ifstream file(k_str_PATH_);
+		std::string str_out;
+
+		std::getline(file, str_out);
+
+		return str_out;
+	} // end method read_line
+
+
+	///<summary>
+	/// Parses a list of ids in the format used by sysfs, e.g. "0-3,8,10-11".
+	///</summary>
+	///<param name="k_str_LIST_">The list to parse.</param>
+	///<param name="vect_out_">Receives the ids in the list.</param>
+	///<returns>True if the list was parsed and not empty, false otherwise.</returns>
+	static bool parse_list(const std::string& k_str_LIST_, std::vector<std::size_t>& vect_out_)
+	{
+		std::size_t u_li_pos = 0;
+
+		try
+		{
+			while (u_li_pos < k_str_LIST_.size())
+			{
+				std::size_t u_li_end = k_str_LIST_.find(',', u_li_pos);
+				const std::string k_str_RANGE = k_str_LIST_.substr(u_li_pos, u_li_end == std::string::npos ? std::string::npos : u_li_end - u_li_pos);
+				const std::size_t ku_li_DASH = k_str_RANGE.find('-');
+				const std::size_t ku_li_FIRST = std::stoul(k_str_RANGE);
+				const std::size_t ku_li_LAST = ku_li_DASH == std::string::npos ? ku_li_FIRST : std::stoul(k_str_RANGE.substr(ku_li_DASH + 1));
+
+				for (std::size_t i = ku_li_FIRST; i <= ku_li_LAST; i++)
+				{
+					vect_out_.push_back(i);
+				} // end for i
+
+				u_li_pos = u_li_end == std::string::npos ? k_str_LIST_.size() : u_li_end + 1;
+			} // end while
+		} // end try
+		catch (const std::exception&)
+		{
+			vect_out_.clear();
+		} // end catch
+
+		return vect_out_.empty() == false;
+	} // end method parse_list
+
+
+	std::vector<CPU_Info> m_vect_cpus;   //! the usable CPUs, ordered by node and then by id
+	std::size_t           mu_li_nnodes;  //! the number of nodes with usable CPUs
+
+}; // end class CPU_Topology
+
+#endif
@@ -0,0 +1,161 @@
+#pragma once
+
+#ifndef __TRACE_BUFFER_HPP
+#define __TRACE_BUFFER_HPP
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t
+#include <atomic>       // atomic, atomic_thread_fence
+#include <memory>       // unique_ptr
+#include <vector>       // vector
+
+///<summary>
+/// Bounded lock-free ring of trace events with a single writer, which overwrites the oldest events once the ring is full.
+///</summary>
+///<remarks>
+/// Recording an event never blocks, allocates or waits for readers. Every slot carries a sequence number that is odd
+/// while the writer is changing the slot, so readers copying the ring at the same time can skip the slots being
+/// overwritten instead of returning torn events. Only one thread may record at a time, any thread may take snapshots.
+///</remarks>
+class Trace_Buffer
+{
+public:
+	///<summary>
+	/// A recorded event, what the id, label, type and argument mean is up to the writer.
+	///</summary>
+	struct Event
+	{
+		std::uint64_t u_li_ns;  //! the time of the event, in nanoseconds since an epoch of the writer's choosing
+		std::uint64_t u_li_id;  //! the id of the object the event is about
+		const char*   p_label;  //! the label of the object, nullptr if none
+		std::uint32_t u_type;   //! the kind of the event
+		std::uint32_t u_arg;    //! an additional argument of the event
+	}; // end struct Event
+
+private:
+	///<summary>
+	/// A slot of the ring, all fields are atomics so snapshots racing with the writer are well defined.
+	///</summary>
+	struct Slot
+	{
+		std::atomic<std::uint64_t> ma_u_li_sequence{ 0 }; //! twice the position of the event plus 2, odd while it is written
+		std::atomic<std::uint64_t> ma_u_li_ns{ 0 };       //! see Event::u_li_ns
+		std::atomic<std::uint64_t> ma_u_li_id{ 0 };       //! see Event::u_li_id
+		std::atomic<const char*>   ma_p_label{ nullptr }; //! see Event::p_label
+		std::atomic<std::uint32_t> ma_u_type{ 0 };        //! see Event::u_type
+		std::atomic<std::uint32_t> ma_u_arg{ 0 };         //! see Event::u_arg
+	}; // end struct Slot
+
+public:
+	// Disallow any kind of copy/move operation, other threads may be taking snapshots
+	Trace_Buffer(const Trace_Buffer&) = delete;
+	Trace_Buffer(Trace_Buffer&&) = delete;
+	Trace_Buffer& operator=(const Trace_Buffer&) = delete;
+	Trace_Buffer& operator=(Trace_Buffer&&) = delete;
+
+
+	///<summary>
+	/// Initializes an empty ring keeping at least the last <paramref name="ku_li_CAPACITY_"/> events.
+	///</summary>
+	///<param name="ku_li_CAPACITY_">The minimum capacity, rounded up to the next power of two.</param>
+	explicit Trace_Buffer(const std::size_t ku_li_CAPACITY_)
+		: ma_u_li_head(0)
+	{
+		std::size_t u_li_capacity = 2;
+
+		while (u_li_capacity < ku_li_CAPACITY_)
+		{
+			u_li_capacity *= 2;
+		} // end while
+
+		mu_li_mask = u_li_capacity - 1;
+		m_arr_slots.reset(new Slot[u_li_capacity]);
+	} // end Constructor
+
+
+	///<summary>
+	/// Records <paramref name="k_event_"/>, overwriting the oldest event if the ring is full.
+	/// Must not be called by more than one thread at a time.
+	///</summary>
+	///<param name="k_event_">The event to record.</param>
+	void Record(const Event& k_event_) noexcept
+	{
+		const std::uint64_t ku_li_POS = ma_u_li_head.load(std::memory_order_relaxed);
+		Slot& slot = m_arr_slots[ku_li_POS & mu_li_mask];
+
+		// readers seeing the odd sequence, or the fields of this event with the sequence of the previous one, skip the slot
+		slot.ma_u_li_sequence.store(2 * ku_li_POS + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		slot.ma_u_li_ns.store(k_event_.u_li_ns, std::memory_order_relaxed);
+		slot.ma_u_li_id.store(k_event_.u_li_id, std::memory_order_relaxed);
+		slot.ma_p_label.store(k_event_.p_label, std::memory_order_relaxed);
+		slot.ma_u_type.store(k_event_.u_type, std::memory_order_relaxed);
+		slot.ma_u_arg.store(k_event_.u_arg, std::memory_order_relaxed);
+
+		slot.ma_u_li_sequence.store(2 * ku_li_POS + 2, std::memory_order_release);
+		ma_u_li_head.store(ku_li_POS + 1, std::memory_order_release);
+	} // end method Record
+
+
+	///<summary>
+	/// Appends the events currently in the ring to <paramref name="vect_events_"/>, oldest first.
+	/// Events overwritten while the snapshot is taken are left out.
+	///</summary>
+	///<param name="vect_events_">Receives the events.</param>
+	void Snapshot(std::vector<Event>& vect_events_) const
+	{
+		const std::uint64_t ku_li_HEAD = ma_u_li_head.load(std::memory_order_acquire);
+		const std::uint64_t ku_li_FIRST = ku_li_HEAD > Capacity() ? ku_li_HEAD - Capacity() : 0;
+
+		for (std::uint64_t u_li_pos = ku_li_FIRST; u_li_pos < ku_li_HEAD; u_li_pos++)
+		{
+			const Slot& slot = m_arr_slots[u_li_pos & mu_li_mask];
+			const std::uint64_t ku_li_SEQUENCE = slot.ma_u_li_sequence.load(std::memory_order_acquire);
+
+			if (ku_li_SEQUENCE != 2 * u_li_pos + 2)
+			{
+				continue;
+			} // end if
+
+			const Event k_EVENT{ slot.ma_u_li_ns.load(std::memory_order_relaxed), slot.ma_u_li_id.load(std::memory_order_relaxed),
+				slot.ma_p_label.load(std::memory_order_relaxed), slot.ma_u_type.load(std::memory_order_relaxed),
+				slot.ma_u_arg.load(std::memory_order_relaxed) };
+
+			// the fields were read before the sequence is read again, an unchanged sequence means they belong together
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (slot.ma_u_li_sequence.load(std::memory_order_relaxed) == ku_li_SEQUENCE)
+			{
+				vect_events_.push_back(k_EVENT);
+			} // end if
+		} // end for u_li_pos
+	} // end method Snapshot
+
+
+	///<summary>
+	/// Accessor for the number of events the ring keeps.
+	///</summary>
+	std::size_t Capacity(void) const noexcept
+	{
+		return mu_li_mask + 1;
+	} // end method Capacity
+
+
+	///<summary>
+	/// Returns the number of events recorded since the ring was initialized, including overwritten ones.
+	///</summary>
+	std::uint64_t N_Recorded(void) const noexcept
+	{
+		return ma_u_li_head.load(std::memory_order_relaxed);
+	} // end method N_Recorded
+
+
+private:
+	std::unique_ptr<Slot[]>    m_arr_slots;    //! the slots of the ring
+	std::size_t                mu_li_mask;     //! the capacity minus one
+	std::atomic<std::uint64_t> ma_u_li_head;   //! the position the next event is recorded at
+
+}; // end class Trace_Buffer
+
+#endif
@@ -0,0 +1,225 @@
+#pragma once
+
+#ifndef __WORK_STEALING_DEQUE_HPP
+#define __WORK_STEALING_DEQUE_HPP
+
+#include <cstddef>      // size_t
+#include <cstdint>      // int64_t
+#include <atomic>       // atomic, atomic_thread_fence
+#include <memory>       // unique_ptr
+#include <vector>       // vector
+#include <type_traits>  // is_trivially_copyable
+
+#include "CacheLine.hpp"
+
+///<summary>
+/// Lock-free single producer, multi consumer deque as described by Chase and Lev, using the
+/// memory orderings given by Le et al. in "Correct and Efficient Work-Stealing for Weak Memory Models".
+///</summary>
+///<remarks>
+/// Only the owning thread may call Push and Pop, which operate on the bottom of the deque.
+/// Any thread may call Steal, which removes elements from the top of the deque.
+/// Elements are stored in atomics, so <typeparamref name="T"/> must be trivially copyable,
+/// typically a pointer to the actual element. The indices are aligned to <typeparamref name="CACHE_LINE_SIZE"/> bytes.
+///</remarks>
+template <class T, std::size_t CACHE_LINE_SIZE = Cache_Line::M_SIZE>
+class Work_Stealing_Deque
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Work_Stealing_Deque requires a trivially copyable element type");
+
+	///<summary>
+	/// Circular array storing the elements of the deque. The array is replaced by a larger one when it is full.
+	///</summary>
+	struct Ring
+	{
+		std::int64_t                    m_li_capacity; //! the number of slots, always a power of two
+		std::int64_t                    m_li_mask;     //! mask used to map indices onto slots
+		std::unique_ptr<std::atomic<T>[]> m_arr_slots; //! the slots
+
+		explicit Ring(const std::int64_t k_li_CAPACITY_)
+			: m_li_capacity(k_li_CAPACITY_), m_li_mask(k_li_CAPACITY_ - 1), m_arr_slots(new std::atomic<T>[k_li_CAPACITY_])
+		{
+		} // end Constructor
+
+		T Load(const std::int64_t k_li_INDEX_) const noexcept
+		{
+			return m_arr_slots[k_li_INDEX_ & m_li_mask].load(std::memory_order_relaxed);
+		} // end method Load
+
+		void Store(const std::int64_t k_li_INDEX_, T item_) noexcept
+		{
+			m_arr_slots[k_li_INDEX_ & m_li_mask].store(item_, std::memory_order_relaxed);
+		} // end method Store
+	}; // end struct Ring
+
+public:
+	static constexpr std::size_t M_DEFAULT_CAPACITY = 256;
+
+	// Disallow any kind of copy/move operation, other threads may be accessing the deque
+	Work_Stealing_Deque(const Work_Stealing_Deque&) = delete;
+	Work_Stealing_Deque(Work_Stealing_Deque&&) = delete;
+	Work_Stealing_Deque& operator=(const Work_Stealing_Deque&) = delete;
+	Work_Stealing_Deque& operator=(Work_Stealing_Deque&&) = delete;
+
+
+	///<summary>
+	/// Initializes an empty deque with room for at least <paramref name="ku_li_CAPACITY_"/> elements.
+	///</summary>
+	///<param name="ku_li_CAPACITY_">The initial capacity, the deque grows as needed.</param>
+	explicit Work_Stealing_Deque(const std::size_t ku_li_CAPACITY_ = M_DEFAULT_CAPACITY)
+		: ma_li_top(0), ma_li_bottom(0)
+	{
+		std::int64_t li_capacity = 2;
+
+		while (li_capacity < static_cast<std::int64_t>(ku_li_CAPACITY_))
+		{
+			li_capacity *= 2;
+		} // end while
+
+		m_vect_rings.emplace_back(new Ring(li_capacity));
+		ma_p_ring.store(m_vect_rings.back().get(), std::memory_order_relaxed);
+	} // end Constructor
+
+
+	///<summary>
+	/// Adds <paramref name="item_"/> to the bottom of the deque. Must only be called by the owning thread.
+	///</summary>
+	///<param name="item_">The element to add.</param>
+	void Push(T item_)
+	{
+		const std::int64_t k_li_BOTTOM = ma_li_bottom.load(std::memory_order_relaxed);
+		const std::int64_t k_li_TOP = ma_li_top.load(std::memory_order_acquire);
+		Ring* p_ring = ma_p_ring.load(std::memory_order_relaxed);
+
+		if (k_li_BOTTOM - k_li_TOP > p_ring->m_li_capacity - 1)
+		{
+			p_ring = grow(p_ring, k_li_TOP, k_li_BOTTOM);
+		} // end if
+
+		p_ring->Store(k_li_BOTTOM, item_);
+		ma_li_bottom.store(k_li_BOTTOM + 1, std::memory_order_release);
+	} // end method Push
+
+
+	///<summary>
+	/// Removes the element at the bottom of the deque. Must only be called by the owning thread.
+	///</summary>
+	///<param name="item_">Receives the removed element.</param>
+	///<returns>True if an element was removed, false if the deque was empty.</returns>
+	bool Pop(T& item_)
+	{
+		const std::int64_t k_li_BOTTOM = ma_li_bottom.load(std::memory_order_relaxed) - 1;
+		Ring* p_ring = ma_p_ring.load(std::memory_order_relaxed);
+
+		ma_li_bottom.store(k_li_BOTTOM, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		std::int64_t li_top = ma_li_top.load(std::memory_order_relaxed);
+		bool b_out = false;
+
+		if (li_top <= k_li_BOTTOM)
+		{
+			item_ = p_ring->Load(k_li_BOTTOM);
+			b_out = true;
+
+			// last element, race against stealers for it
+			if (li_top == k_li_BOTTOM)
+			{
+				b_out = ma_li_top.compare_exchange_strong(li_top, li_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				ma_li_bottom.store(k_li_BOTTOM + 1, std::memory_order_relaxed);
+			} // end if
+		} // end if
+		else
+		{
+			ma_li_bottom.store(k_li_BOTTOM + 1, std::memory_order_relaxed);
+		} // end else
+
+		return b_out;
+	} // end method Pop
+
+
+	///<summary>
+	/// Attempts to remove the element at the top of the deque. May be called by any thread.
+	///</summary>
+	///<param name="item_">Receives the removed element.</param>
+	///<returns>True if an element was removed, false if the deque was empty or another thread won the race.</returns>
+	bool Steal(T& item_)
+	{
+		std::int64_t li_top = ma_li_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const std::int64_t k_li_BOTTOM = ma_li_bottom.load(std::memory_order_acquire);
+
+		if (li_top >= k_li_BOTTOM)
+		{
+			return false;
+		} // end if
+
+		const Ring* kp_RING = ma_p_ring.load(std::memory_order_acquire);
+		const T k_ITEM = kp_RING->Load(li_top);
+
+		if (ma_li_top.compare_exchange_strong(li_top, li_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) == false)
+		{
+			return false;
+		} // end if
+
+		item_ = k_ITEM;
+
+		return true;
+	} // end method Steal
+
+
+	///<summary>
+	/// Returns the number of elements in the deque at the time of invocation.
+	///</summary>
+	///<returns>The approximate number of elements in the deque.</returns>
+	std::size_t Size(void) const noexcept
+	{
+		const std::int64_t k_li_BOTTOM = ma_li_bottom.load(std::memory_order_acquire);
+		const std::int64_t k_li_TOP = ma_li_top.load(std::memory_order_acquire);
+
+		return k_li_BOTTOM > k_li_TOP ? static_cast<std::size_t>(k_li_BOTTOM - k_li_TOP) : 0;
+	} // end method Size
+
+
+	///<summary>
+	/// Returns whether or not the deque was empty at the time of invocation.
+	///</summary>
+	///<returns>True iff the deque is empty.</returns>
+	bool Empty(void) const noexcept
+	{
+		return Size() == 0;
+	} // end method Empty
+
+
+private:
+	///<summary>
+	/// Replaces <paramref name="p_ring_"/> with a ring of twice the capacity.
+	///</summary>
+	///<remarks>
+	/// Stealers may still be reading from the old ring, so it is kept alive until the deque is destroyed.
+	///</remarks>
+	Ring* grow(Ring* p_ring_, const std::int64_t k_li_TOP_, const std::int64_t k_li_BOTTOM_)
+	{
+		m_vect_rings.emplace_back(new Ring(p_ring_->m_li_capacity * 2));
+		Ring* p_new = m_vect_rings.back().get();
+
+		for (auto i = k_li_TOP_; i < k_li_BOTTOM_; i++)
+		{
+			p_new->Store(i, p_ring_->Load(i));
+		} // end for i
+
+		ma_p_ring.store(p_new, std::memory_order_release);
+
+		return p_new;
+	} // end method grow
+
+
+	alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> ma_li_top;    //! index of the top element, advanced by stealers
+	alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> ma_li_bottom; //! index one past the bottom element, owned by the owner
+	std::atomic<Ring*>                                    ma_p_ring;    //! the ring currently in use
+
+	std::vector<std::unique_ptr<Ring>> m_vect_rings;    //! all rings ever used by this deque, modified only by the owner
+
+}; // end class Work_Stealing_Deque
+
+#endif